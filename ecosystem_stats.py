@@ -5,6 +5,7 @@ import threading
 import time
 import os
 import struct
+import mmap
 from collections import deque
 
 class EcosystemStats:
@@ -22,14 +23,38 @@ class EcosystemStats:
         self.temperature_data = deque(maxlen=self.max_data_points)
         self.bleached_count_data = deque(maxlen=self.max_data_points)
         
+        # Shared-memory stats block layout (see src/stats_shm.c)
+        self.SHM_MAGIC = 0x54425354
+        self.SHM_LAYOUT_VERSION = 1
+        self.SHM_SEQUENCE_OFFSET = 8
+        self.SHM_STAGE_COUNT_OFFSET = 12
+        self.SHM_STATS_OFFSET = 16
+        self.SHM_STAGES_OFFSET = 36
+
         # System state
-        self.stats_file = "simulation_stats.tmp"
+        self.stats_file = "simulation_stats.shm"
+        self.shm = None
+        self.shm_file_handle = None
+        self.shm_control_offset = None
+        self.last_sequence = -1
+        self.last_sequence_change = time.time()
+        self.control_sequence = 0
         self.start_time = time.time()
         self.running = False
         self.update_thread = None
         self.simulation_connected = False
         self.current_temperature = 0.0
         self.bleached_count = 0
+
+        # Frame profiler stage timings (p50, p95) in ms - order matches
+        # the ProfStage enum in include/profiler.h
+        self.profiler_stage_names = [
+            "grid rebuild", "repulsion", "chains", "plants_grow",
+            "gas heatmap", "integration", "bounds/aging", "fish vision",
+            "fish_update", "brain inference", "python bridge",
+            "temperature", "render"
+        ]
+        self.stage_timings = []
         
         print("Setting up GUI components...")
         self.setup_gui()
@@ -176,7 +201,14 @@ class EcosystemStats:
         self.plant_canvas.pack(fill=tk.BOTH, expand=True)
     
     def setup_info_panel(self, parent):
-        """Setup information log panel"""
+        """Setup frame profiler display and information log panel"""
+        profiler_frame = ttk.LabelFrame(parent, text="Frame Profiler (p50 / p95 ms per stage)", padding=5)
+        profiler_frame.pack(fill=tk.X, pady=(5, 0))
+
+        self.profiler_label = ttk.Label(profiler_frame, text="Waiting for profiler data...",
+                                        font=("Courier", 8), justify=tk.LEFT)
+        self.profiler_label.pack(anchor=tk.W)
+
         info_frame = ttk.LabelFrame(parent, text="System Log", padding=5)
         info_frame.pack(fill=tk.X, pady=(5, 0))
         
@@ -249,10 +281,13 @@ class EcosystemStats:
             else:
                 self.temp_label.config(foreground="red")
             
-            # Write temperature control file for simulation
-            with open("temperature_control.tmp", "w") as f:
-                f.write(f"{temp_value:.1f}")
-            
+            # Post the temperature through the shared-memory block: the
+            # value first, then the sequence bump the engine polls for
+            if self.shm is not None and self.shm_control_offset is not None:
+                struct.pack_into('<f', self.shm, self.shm_control_offset, temp_value)
+                self.control_sequence = (self.control_sequence + 1) & 0xFFFFFFFF
+                struct.pack_into('<I', self.shm, self.shm_control_offset + 4, self.control_sequence)
+
             # Update status message
             if temp_value == 0.0:
                 self.warning_label.config(text="Temperature Offset 0.0°C - Normal baseline temperature", 
@@ -280,42 +315,103 @@ class EcosystemStats:
             print(f"[{time.strftime('%H:%M:%S')}] {message}")
     
     def read_stats_file(self):
-        """Read simulation statistics from binary file"""
+        """Read a tear-free stats snapshot from the shared-memory block"""
         try:
-            if not os.path.exists(self.stats_file):
+            if not self.ensure_shm_mapped():
                 return None, None, None, None, None
-            
-            # Check file age to detect simulation status
-            file_age = time.time() - os.path.getmtime(self.stats_file)
-            if file_age > 5.0:
-                if self.simulation_connected:
-                    self.log("Lost connection to simulation")
-                    self.simulation_connected = False
-                return None, None, None, None, None
-            
-            # Read binary data format: [nutrition, fish_count, plant_count, temperature, bleached_count]
-            with open(self.stats_file, 'rb') as f:
-                data = f.read()
-                
-                if len(data) == 20:  # 5 floats = 20 bytes
-                    total_nutrition, fish_f, plant_f, temp, bleached_f = struct.unpack('fffff', data)
-                    fish_count = int(fish_f)
-                    plant_count = int(plant_f)
-                    bleached_count = int(bleached_f)
-                    
-                    if not self.simulation_connected:
-                        self.log(f"Connected to simulation: {fish_count} fish, {plant_count} plants, temp {temp:.1f}°C")
-                        self.simulation_connected = True
-                    
-                    return total_nutrition, fish_count, plant_count, temp, bleached_count
-                else:
-                    self.log(f"Invalid data format: {len(data)} bytes")
+
+            # Seqlock read: the engine makes the sequence odd while it
+            # writes, so retry until we see a stable even sequence
+            for _ in range(10):
+                seq_before = struct.unpack_from('<I', self.shm, self.SHM_SEQUENCE_OFFSET)[0]
+                if seq_before & 1:
+                    continue
+
+                stage_count = struct.unpack_from('<I', self.shm, self.SHM_STAGE_COUNT_OFFSET)[0]
+                total_nutrition, fish_f, plant_f, temp, bleached_f = \
+                    struct.unpack_from('<5f', self.shm, self.SHM_STATS_OFFSET)
+                stage_floats = struct.unpack_from(f'<{stage_count * 2}f', self.shm,
+                                                  self.SHM_STAGES_OFFSET) if stage_count else ()
+
+                seq_after = struct.unpack_from('<I', self.shm, self.SHM_SEQUENCE_OFFSET)[0]
+                if seq_before != seq_after:
+                    continue
+
+                # Detect a stalled or restarted engine via the sequence
+                now = time.time()
+                if seq_after != self.last_sequence:
+                    self.last_sequence = seq_after
+                    self.last_sequence_change = now
+                elif now - self.last_sequence_change > 5.0:
+                    if self.simulation_connected:
+                        self.log("Lost connection to simulation")
+                        self.simulation_connected = False
+                    self.close_shm()
                     return None, None, None, None, None
-                    
+
+                self.stage_timings = [(stage_floats[i * 2], stage_floats[i * 2 + 1])
+                                      for i in range(stage_count)]
+                fish_count = int(fish_f)
+                plant_count = int(plant_f)
+                bleached_count = int(bleached_f)
+
+                if not self.simulation_connected:
+                    self.log(f"Connected to simulation: {fish_count} fish, {plant_count} plants, temp {temp:.1f}°C")
+                    self.simulation_connected = True
+
+                return total_nutrition, fish_count, plant_count, temp, bleached_count
+
+            return None, None, None, None, None
+
         except Exception as e:
             if self.simulation_connected:
                 self.log(f"Error reading stats: {e}")
+            self.close_shm()
             return None, None, None, None, None
+
+    def ensure_shm_mapped(self):
+        """Map the engine's shared stats block, validating its header"""
+        if self.shm is not None:
+            return True
+
+        try:
+            if not os.path.exists(self.stats_file):
+                return False
+
+            self.shm_file_handle = open(self.stats_file, 'r+b')
+            self.shm = mmap.mmap(self.shm_file_handle.fileno(), 0)
+
+            magic, layout_version = struct.unpack_from('<2I', self.shm, 0)
+            if magic != self.SHM_MAGIC or layout_version != self.SHM_LAYOUT_VERSION:
+                self.close_shm()
+                return False
+
+            stage_count = struct.unpack_from('<I', self.shm, self.SHM_STAGE_COUNT_OFFSET)[0]
+            self.shm_control_offset = self.SHM_STAGES_OFFSET + stage_count * 8
+            # Continue the control sequence from the block so a monitor
+            # restart does not replay an old temperature
+            self.control_sequence = struct.unpack_from('<I', self.shm, self.shm_control_offset + 4)[0]
+            self.last_sequence = -1
+            self.last_sequence_change = time.time()
+            return True
+        except Exception:
+            self.close_shm()
+            return False
+
+    def close_shm(self):
+        """Drop the mapping so the next read attempt remaps a fresh file"""
+        if self.shm is not None:
+            try:
+                self.shm.close()
+            except Exception:
+                pass
+            self.shm = None
+        if self.shm_file_handle is not None:
+            try:
+                self.shm_file_handle.close()
+            except Exception:
+                pass
+            self.shm_file_handle = None
     
     def data_update_loop(self):
         """Main data collection loop - only updates when data changes"""
@@ -369,8 +465,31 @@ class EcosystemStats:
         self.draw_chart(self.fish_canvas, "Fish Population", 
                        self.fish_count, "darkblue")
         
-        self.draw_chart(self.plant_canvas, "Plant Population", 
+        self.draw_chart(self.plant_canvas, "Plant Population",
                        self.plant_count, "darkred")
+
+        self.update_profiler_display()
+
+    def update_profiler_display(self):
+        """Refresh the per-stage frame timing readout"""
+        if not self.stage_timings:
+            return
+
+        lines = []
+        for i, (p50, p95) in enumerate(self.stage_timings):
+            name = (self.profiler_stage_names[i] if i < len(self.profiler_stage_names)
+                    else f"stage {i}")
+            lines.append(f"{name:<16} {p50:7.2f} / {p95:7.2f}")
+
+        # Two columns to keep the panel compact
+        half = (len(lines) + 1) // 2
+        rows = []
+        for i in range(half):
+            left = lines[i]
+            right = lines[i + half] if i + half < len(lines) else ""
+            rows.append(f"{left}    {right}")
+
+        self.profiler_label.config(text="\n".join(rows))
     
     def draw_chart(self, canvas, title, data, color):
         """Draw standard chart with responsive layout"""
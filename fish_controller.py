@@ -8,6 +8,12 @@ import os
 import signal
 import sys
 
+# Benchmark runs propagate a fixed seed so Python-side network
+# initialization and exploration are reproducible
+_bench_seed = os.environ.get("TB_RANDOM_SEED")
+if _bench_seed is not None:
+    random.seed(int(_bench_seed))
+
 # Global state
 fish_brains = {}
 frame_counter = 0
@@ -17,6 +23,39 @@ shutdown_requested = False
 # Performance tracking for model saving
 reproduction_tracking = {}  # fish_id -> reproduction_count
 
+# Batched RL bridge: zero-copy views over the C staging buffers
+# (inputs, outputs, rewards as float views; active as byte view)
+batch_inputs = None
+batch_outputs = None
+batch_rewards = None
+batch_active = None
+batch_fish_count = 0
+
+# When the native inference engine is present, C runs the forward passes
+# every frame and Python only trains and pushes updated weights
+native_inference = False
+
+def init_batch_views():
+    """Acquire the shared RL matrices from the simulation (once)"""
+    global batch_inputs, batch_outputs, batch_rewards, batch_active
+    global native_inference
+
+    try:
+        inputs_mv, outputs_mv, rewards_mv, active_mv = simulation.fish_get_rl_batch_views()
+        batch_inputs = inputs_mv.cast('f')
+        batch_outputs = outputs_mv.cast('f')
+        batch_rewards = rewards_mv.cast('f')
+        batch_active = active_mv
+        print("Batched RL bridge active: zero-copy input/output matrices")
+    except AttributeError:
+        print("Batched RL bridge unavailable, using per-fish calls")
+        return False
+
+    native_inference = hasattr(simulation, 'fish_brain_set_weights')
+    if native_inference:
+        print("Native inference engine detected: Python handles training only")
+    return True
+
 class PureNeuralFishBrain:
     def __init__(self, fish_id, parent_brain=None):
         self.fish_id = fish_id
@@ -56,6 +95,19 @@ class PureNeuralFishBrain:
         # Action consistency
         self.last_outputs = [0.0, 0.5, 0.1]
         self.momentum = 0.15
+
+        # Hand the initial weights to the native inference engine
+        self.push_weights()
+
+    def push_weights(self):
+        """Push current weights to the native inference engine"""
+        if not native_inference:
+            return
+
+        w1 = [w for row in self.weights1 for w in row]
+        w2 = [w for row in self.weights2 for w in row]
+        simulation.fish_brain_set_weights(self.fish_id, w1, self.bias1,
+                                          w2, self.bias2, self.exploration_rate)
     
     def initialize_random_network(self):
         # Xavier/Glorot initialization
@@ -157,6 +209,10 @@ class PureNeuralFishBrain:
         return [turn_direction, movement_strength, eat_command], hidden
     
     def get_state(self):
+        if batch_inputs is not None and self.fish_id < batch_fish_count:
+            base = self.fish_id * self.input_size
+            return list(batch_inputs[base:base + self.input_size])
+
         inputs = simulation.fish_get_rl_inputs(self.fish_id)
         if inputs is None:
             return [0.0, 0.0, 0.5, 1.0, 0.0, 0.0, 0.0]
@@ -267,14 +323,30 @@ class PureNeuralFishBrain:
                 self.species_type = fish_info[0]
                 self.is_predator = fish_info[1]
         
-        # Choose action
-        action = self.choose_action(current_state)
-        
-        # Apply action
-        simulation.fish_set_rl_outputs(self.fish_id, action[0], action[1], action[2])
-        
+        use_batch = batch_outputs is not None and self.fish_id < batch_fish_count
+
+        if native_inference and use_batch:
+            # The native engine already chose and applied the action this
+            # frame; read it back and learn from it
+            base = self.fish_id * self.output_size
+            action = list(batch_outputs[base:base + self.output_size])
+            self.last_outputs = action[:]
+            reward = batch_rewards[self.fish_id]
+        else:
+            # Choose and apply the action in Python
+            action = self.choose_action(current_state)
+
+            if use_batch:
+                base = self.fish_id * self.output_size
+                batch_outputs[base] = action[0]
+                batch_outputs[base + 1] = action[1]
+                batch_outputs[base + 2] = action[2]
+                reward = batch_rewards[self.fish_id]
+            else:
+                simulation.fish_set_rl_outputs(self.fish_id, action[0], action[1], action[2])
+                reward = simulation.fish_get_last_reward(self.fish_id)
+
         # Learn from reward
-        reward = simulation.fish_get_last_reward(self.fish_id)
         self.total_reward += reward
         
         self.learn_from_experience(current_state, action, reward)
@@ -288,8 +360,11 @@ class PureNeuralFishBrain:
             self.replay_experience()
         
         # Decay exploration
-        self.exploration_rate = max(self.min_exploration, 
+        self.exploration_rate = max(self.min_exploration,
                                    self.exploration_rate * self.exploration_decay)
+
+        # Sync the trained weights back to the native inference engine
+        self.push_weights()
     
     def to_dict(self):
         """Convert brain to dictionary for saving"""
@@ -406,13 +481,16 @@ def save_best_models():
                 best_herbivore = brain
                 best_herbivore_score = performance_score
     
-    # Save models
+    # Save models (farm workers get a per-worker suffix so parallel
+    # runs never clobber each other; the parent merges by score)
+    model_suffix = os.environ.get("TB_MODEL_SUFFIX", "")
     models_saved = 0
-    
+
     if best_herbivore:
         herbivore_model = best_herbivore.to_dict()
-        filename = "best_herbivore_model.json"
-        
+        herbivore_model["performance_score"] = best_herbivore_score
+        filename = f"best_herbivore_model{model_suffix}.json"
+
         with open(filename, 'w') as f:
             json.dump(herbivore_model, f, indent=2)
         
@@ -427,8 +505,9 @@ def save_best_models():
     
     if best_predator:
         predator_model = best_predator.to_dict()
-        filename = "best_predator_model.json"
-        
+        predator_model["performance_score"] = best_predator_score
+        filename = f"best_predator_model{model_suffix}.json"
+
         with open(filename, 'w') as f:
             json.dump(predator_model, f, indent=2)
         
@@ -508,39 +587,56 @@ def print_evolution_progress():
 
 def update_fish():
     """Main update function with model saving on shutdown"""
-    global frame_counter, shutdown_requested
+    global frame_counter, shutdown_requested, batch_fish_count
     frame_counter += 1
-    
+
     # Initialize on first call
     if frame_counter == 1:
         # Set up signal handler for graceful shutdown
         signal.signal(signal.SIGINT, signal_handler)
         signal.signal(signal.SIGTERM, signal_handler)
-        
+
+        # Acquire zero-copy RL matrices
+        init_batch_views()
+
         # Create brains for initial fish
         initial_fish_count = simulation.fish_get_count()
         for fish_id in range(initial_fish_count):
             create_brain_for_fish(fish_id)
-        
+
         print("Neural Network Controller with Model Saving initialized!")
         print("Updated input system: predators use inputs 0,1,3 for prey targeting")
         print("Press Ctrl+C to save best models and exit gracefully")
-    
+
     # Handle shutdown request
     if shutdown_requested:
         return
-    
+
     # Scan for new fish
     scan_for_new_fish()
-    
+
     # Track reproductions
     track_reproduction_events()
-    
+
     # Update each fish
-    for fish_id, brain in list(fish_brains.items()):
-        position = simulation.fish_get_position(fish_id)
-        if position:
-            brain.update()
+    if batch_inputs is not None:
+        # Batched path: one gather call, process all brains against the
+        # shared matrices, one commit call
+        batch_fish_count = simulation.fish_sync_rl_batch()
+
+        for fish_id, brain in list(fish_brains.items()):
+            if fish_id < batch_fish_count and batch_active[fish_id]:
+                brain.update()
+
+        # With native inference the engine owns the outputs; committing
+        # would overwrite them with our stale copies
+        if not native_inference:
+            simulation.fish_commit_rl_outputs()
+    else:
+        for fish_id, brain in list(fish_brains.items()):
+            position = simulation.fish_get_position(fish_id)
+            if position:
+                brain.update()
     
     # Evolution progress every 30 seconds
     if frame_counter % (60 * 30) == 0:
@@ -0,0 +1,26 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// Deterministic benchmark harness. Activated with
+// "--bench [scenario] [frames] [seed]" on the command line; stage
+// timings come from the always-on profiler (see profiler.h).
+// Returns 1 when benchmark mode was requested on the command line
+int bench_parse_args(int argc, char* argv[]);
+int bench_is_active(void);
+
+unsigned int bench_get_seed(void);
+int bench_get_frame_limit(void);
+const char* bench_get_scenario_name(void);
+
+// Deterministic population setup (replaces populate_reef_randomly)
+void bench_setup_scenario(void);
+
+// Per-frame bookkeeping; accumulates the profiler's stage timings and
+// returns 1 once the frame limit is reached. Call after
+// profiler_frame_end().
+int bench_frame_done(void);
+
+// Print wall time and per-stage breakdown
+void bench_report(void);
+
+#endif // BENCH_H
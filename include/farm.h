@@ -0,0 +1,27 @@
+#ifndef FARM_H
+#define FARM_H
+
+// Multi-process headless training farm. Activated with
+// "--farm <workers> [frames]" on the command line: the parent spawns
+// N copies of this executable as independent worlds, each seeded
+// differently and saving its best models to per-worker files, then
+// merges the highest-scoring models into the canonical filenames when
+// every worker has finished.
+
+// Returns 1 when either farm role (parent or worker) was requested
+int farm_parse_args(int argc, char* argv[]);
+int farm_is_parent(void);
+int farm_is_worker(void);
+
+// Worker parameters
+unsigned int farm_get_seed(void);
+
+// Per-frame bookkeeping for workers; returns 1 once the frame budget
+// is exhausted. Call after profiler_frame_end().
+int farm_frame_done(void);
+
+// Parent entry point: spawn workers, wait for them, merge the saved
+// models. Returns the process exit code.
+int farm_run_parent(const char* exe_path);
+
+#endif // FARM_H
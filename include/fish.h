@@ -29,6 +29,9 @@ int fish_get_count(void);                    // Returns active fish count
 int fish_get_highest_slot(void);             // Returns highest used slot for efficient iteration
 Fish* fish_get_by_id(int fish_id);          // Validated fish access
 Fish* fish_get_all(void);                   // Returns fish array
+int fish_get_id_by_node(int node_id);       // O(1) node -> fish reverse lookup (-1 if none)
+Fish* fish_get_by_node(int node_id);        // O(1) node -> fish reverse lookup (NULL if none)
+void fish_refresh_node_lookup(void);        // Rebuild reverse index after compaction
 
 // Debug and visualization
 void fish_toggle_ray_rendering(void);
@@ -40,6 +43,9 @@ float fish_get_total_nutrition_consumed(void);
 float fish_get_total_nutrition_defecated(void);
 float fish_get_nutrition_balance(void);
 
+// Snapshot support: replace the fish population and rebuild derived state
+void fish_snapshot_restore(const Fish* fish, int count);
+
 // Internal system access
 Fish* fish_internal_get_array(void);
 FishType* fish_internal_get_types(void);
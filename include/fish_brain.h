@@ -0,0 +1,30 @@
+#ifndef FISH_BRAIN_H
+#define FISH_BRAIN_H
+
+// Native inference engine for fish neural networks. Runs the per-frame
+// forward passes in C so Python only handles training and inheritance.
+
+// Hidden layer width of the fish networks (must match fish_controller.py)
+#define FISH_BRAIN_HIDDEN_SIZE 20
+
+// System initialization and cleanup
+int fish_brain_init(void);
+void fish_brain_cleanup(void);
+
+// Load or replace the weights for one fish (flattened row-major
+// matrices: w1 is input x hidden, w2 is hidden x output)
+void fish_brain_set_weights(int fish_id, const float* w1, const float* b1,
+                            const float* w2, const float* b2,
+                            float exploration_rate);
+
+// Drop the weights for a fish slot (call when the slot is reused)
+void fish_brain_clear(int fish_id);
+
+// Whether a fish has weights loaded
+int fish_brain_is_loaded(int fish_id);
+
+// Run batched inference for all active fish with loaded weights,
+// writing actions into each fish's rl_outputs
+void fish_brain_update(void);
+
+#endif // FISH_BRAIN_H
@@ -0,0 +1,30 @@
+#ifndef FISH_GRID_H
+#define FISH_GRID_H
+
+#include "types.h"
+
+// Coarse spatial index over the fish population. Cells are sized for
+// fish_detection_range queries, so nearest-fish scans touch a handful
+// of cells instead of the whole school.
+#define FISH_GRID_SIZE 200.0f
+
+// System initialization and cleanup
+int fish_grid_init(void);
+void fish_grid_cleanup(void);
+
+// Rebuild the index from the current fish population (once per frame,
+// before the sensing pass)
+void fish_grid_rebuild(void);
+
+// Cell iteration: head returns the first fish id in a cell (-1 when the
+// cell is empty or out of bounds), next chains to the following fish in
+// the same cell (-1 at the end)
+int fish_grid_cell_head(int grid_x, int grid_y);
+int fish_grid_next(int fish_id);
+
+// Grid dimensions and coordinate conversion
+int fish_grid_get_width(void);
+int fish_grid_get_height(void);
+void fish_grid_world_to_coords(float world_x, float world_y, int* grid_x, int* grid_y);
+
+#endif // FISH_GRID_H
@@ -1,7 +1,11 @@
 #ifndef FLOW_H
 #define FLOW_H
 
+#include "types.h"
+
+#ifndef HEADLESS_BUILD
 #include <SDL2/SDL.h>
+#endif
 
 // Flow field system
 int flow_init(void);
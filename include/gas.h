@@ -1,7 +1,11 @@
 #ifndef GAS_H
 #define GAS_H
 
+#include "types.h"
+
+#ifndef HEADLESS_BUILD
 #include <SDL2/SDL.h>
+#endif
 
 // Gas layer system
 int gas_init(void);
@@ -22,4 +26,13 @@ float gas_get_oxygen_at(float world_x, float world_y);
 void gas_decay_oxygen(void);
 void gas_update_heatmap(void);
 
+// Dirty-region notifications for the tiled production rebuild
+void gas_mark_dirty_region(float world_x, float world_y, float radius);
+void gas_mark_plant_changed(float world_x, float world_y, int plant_type);
+
+// Snapshot support: direct grid access and restore
+int gas_get_grid_cell_count(void);
+float* gas_get_grid(void);
+void gas_snapshot_restore(const float* grid);
+
 #endif // GAS_H
\ No newline at end of file
@@ -10,9 +10,15 @@ void grid_cleanup(void);
 // Grid management
 void grid_clear(void);
 void grid_add_node(int node_index);
+void grid_update_node(int node_index);
 void grid_rebuild(void);
 
 // Grid queries
+GridCell* grid_get_cell(int grid_x, int grid_y);
+int grid_get_width(void);
+int grid_get_height(void);
+int grid_get_occupied_count(void);
+void grid_get_occupied_cell_coords(int occupied_index, int* grid_x, int* grid_y);
 int grid_get_cells_at_position(float world_x, float world_y, GridCell** cells, int max_cells);
 void grid_get_nearby_cells(int grid_x, int grid_y, int radius, GridCell** cells, int* cell_count, int max_cells);
 
@@ -0,0 +1,28 @@
+#ifndef LAZY_ALLOC_H
+#define LAZY_ALLOC_H
+
+#include <stddef.h>
+
+// Lazily committed array backing. Reserves address space for the full
+// capacity up front (so pointers and indices stay stable forever) but
+// only commits zeroed physical pages slab by slab as the population
+// grows. Memory footprint tracks actual usage instead of MAX_* limits.
+typedef struct {
+    void* base;             // Start of the reserved region
+    size_t element_size;    // Size of one element in bytes
+    size_t capacity;        // Maximum number of elements (reserved)
+    size_t committed;       // Elements currently backed by real pages
+    size_t reserved_bytes;  // Total reserved bytes (page aligned)
+} LazyBuffer;
+
+// Reserve address space for max_elements; commits nothing yet
+int lazy_buffer_init(LazyBuffer* buffer, size_t element_size, size_t max_elements);
+
+// Release the reservation
+void lazy_buffer_cleanup(LazyBuffer* buffer);
+
+// Commit pages so elements [0, element_count) are usable; newly
+// committed memory is zeroed. Returns 0 on failure or overflow.
+int lazy_buffer_ensure(LazyBuffer* buffer, size_t element_count);
+
+#endif // LAZY_ALLOC_H
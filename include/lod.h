@@ -0,0 +1,26 @@
+#ifndef LOD_H
+#define LOD_H
+
+#include "types.h"
+
+// Level-of-detail scheduler: the world is split into coarse regions
+// and regions that are neither on screen nor near any fish update at a
+// reduced rate. Skipped frames are banked per region, so a consumer
+// that receives N steps applies N frames worth of probability or timer
+// progress and aggregate dynamics stay identical.
+#define LOD_REGION_SIZE 500.0f
+#define LOD_DORMANT_INTERVAL 8
+
+// System initialization and cleanup
+int lod_init(void);
+void lod_cleanup(void);
+
+// Recompute region priorities and grant banked steps (once per frame,
+// before the consumers run)
+void lod_update(void);
+
+// Steps to apply for this position this frame: 0 = region sleeps this
+// frame, N >= 1 = apply N frames worth of updates
+int lod_region_steps(float world_x, float world_y);
+
+#endif // LOD_H
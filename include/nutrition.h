@@ -1,7 +1,11 @@
 #ifndef NUTRITION_H
 #define NUTRITION_H
 
+#include "types.h"
+
+#ifndef HEADLESS_BUILD
 #include <SDL2/SDL.h>
+#endif
 
 // Nutrition floor system
 int nutrition_init(void);
@@ -23,6 +27,12 @@ void nutrition_deplete_at_position(float world_x, float world_y, float depletion
 void nutrition_add_at_position(float world_x, float world_y, float addition_amount, float radius);
 void nutrition_regenerate(void);
 
+// Snapshot support: direct grid access and restore
+int nutrition_get_grid_cell_count(void);
+float* nutrition_get_grid(void);
+float* nutrition_get_original_grid(void);
+void nutrition_snapshot_restore(const float* grid, const float* original);
+
 // Nutrition balance tracking
 float nutrition_get_total_added(void);
 float nutrition_get_total_depleted(void);
@@ -1,6 +1,10 @@
 #ifndef PHYSICS_H
 #define PHYSICS_H
 
+// System initialization and cleanup
+int physics_init(void);
+void physics_cleanup(void);
+
 // Physics engine main update function
 void physics_update(void);
 
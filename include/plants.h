@@ -9,6 +9,11 @@ int plants_load_config(const char* filename);
 // Plant growth system
 void plants_grow(void);
 
+// Growth candidate queue (nodes enter at spawn, refresh after node
+// indices change)
+void plants_register_growth_candidate(int node_id);
+void plants_refresh_growth_candidates(void);
+
 // Environmental nutrition management
 void plants_add_environmental_nutrition(float amount);
 
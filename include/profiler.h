@@ -0,0 +1,37 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Always-on frame profiler. Each stage of the main loop is timed with a
+// monotonic clock and folded into a rolling window so external tools
+// can query live percentiles. Overhead per stage is two clock reads.
+typedef enum {
+    PROF_STAGE_GRID = 0,       // grid rebuild / compaction
+    PROF_STAGE_REPULSION,      // repulsion forces
+    PROF_STAGE_CHAINS,         // chain spring forces
+    PROF_STAGE_PLANTS,         // plants_grow (includes gas)
+    PROF_STAGE_GAS,            // gas heatmap update
+    PROF_STAGE_INTEGRATION,    // hot-array gather/integrate/scatter
+    PROF_STAGE_BOUNDS,         // world bounds, aging, grid maintenance
+    PROF_STAGE_VISION,         // fish vision rays and RL inputs
+    PROF_STAGE_FISH,           // fish_update (includes vision)
+    PROF_STAGE_BRAIN,          // native neural network inference
+    PROF_STAGE_PYTHON,         // Python training bridge
+    PROF_STAGE_TEMPERATURE,    // coral bleaching
+    PROF_STAGE_RENDER,         // rendering (SDL build only)
+    PROF_STAGE_COUNT
+} ProfStage;
+
+// Stage timing - always active
+void profiler_stage_begin(ProfStage stage);
+void profiler_stage_end(ProfStage stage);
+
+// Fold the current frame's accumulators into the rolling window;
+// called once at the end of every main-loop iteration
+void profiler_frame_end(void);
+
+// Query helpers (milliseconds)
+float profiler_get_last_ms(ProfStage stage);
+float profiler_get_percentile_ms(ProfStage stage, float percentile);
+const char* profiler_get_stage_name(ProfStage stage);
+
+#endif // PROFILER_H
@@ -11,4 +11,8 @@ int python_api_run_script(const char* script_path);
 // Called each frame to update Python-controlled fish
 void python_api_update(void);
 
+// Ask the controller script to save its best models (used by farm
+// workers, which exit on a frame budget instead of a signal)
+void python_api_request_model_save(void);
+
 #endif // PYTHON_API_H
\ No newline at end of file
@@ -10,18 +10,44 @@ void simulation_cleanup(void);
 // Node and chain management
 int simulation_add_node(float x, float y, int plant_type);
 int simulation_add_chain(int node1, int node2);
+void simulation_remove_node(int node_index);
+void simulation_remove_chain(int chain_index);
+int simulation_maybe_compact(void);
 int simulation_find_node_at_position(float world_x, float world_y);
 
-// NEW: Seed immunity system
+// NEW: Seed immunity system (expiry is birth-frame arithmetic, no
+// per-frame timer pass)
 int simulation_add_seed_node(float x, float y, int plant_type);
-void simulation_update_seed_timers(void);
+int simulation_is_seed_immune(int node_index);
+
+// Hot-path SoA integration (gather -> vectorized kernel -> scatter)
+void simulation_gather_hot_arrays(void);
+void simulation_integrate_hot_arrays(float drag);
+void simulation_scatter_hot_arrays(void);
 
 // State accessors
 Node* simulation_get_nodes(void);
 Chain* simulation_get_chains(void);
 int simulation_get_node_count(void);
+int simulation_get_active_node_count(void);
 int simulation_get_chain_count(void);
 
+// Cached per-node physics attributes, indexed by node id
+float* simulation_get_node_mobility(void);
+float* simulation_get_node_repulsion(void);
+
+// Corpse registry: node ids of live corpses, kept current through
+// add/remove so decay updates skip the plant population entirely.
+// Entries may be swap-removed under a caller iterating backwards.
+int simulation_get_corpse_count(void);
+const int* simulation_get_corpse_ids(void);
+
+// Snapshot support: replace the world with saved arrays and rebuild
+// all derived state
+int simulation_snapshot_restore(const Node* nodes, int node_count,
+                                const Chain* chains, int chain_count,
+                                int frame_counter);
+
 // Selection management
 int simulation_get_selected_node(void);
 int simulation_get_selection_mode(void);
@@ -0,0 +1,15 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+// Binary world snapshots written and restored through memory-mapped
+// I/O: nodes, chains, fish, nutrition terrain and the oxygen field in
+// one file, so long-running worlds can be checkpointed and resumed
+// without replaying regrowth.
+
+#define SNAPSHOT_DEFAULT_FILE "world_snapshot.bin"
+
+// Both return 1 on success, 0 on failure
+int snapshot_save(const char* filename);
+int snapshot_load(const char* filename);
+
+#endif // SNAPSHOT_H
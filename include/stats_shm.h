@@ -0,0 +1,20 @@
+#ifndef STATS_SHM_H
+#define STATS_SHM_H
+
+// Shared-memory stats transport. The engine maps a small fixed-layout
+// file ("simulation_stats.shm") that the Python monitor maps read-write;
+// snapshots are published under a seqlock so readers never see torn
+// data, and the temperature slider writes back through the same block.
+// This replaces the simulation_stats.tmp / temperature_control.tmp
+// file polling.
+int stats_shm_init(void);
+void stats_shm_cleanup(void);
+
+// Publish a stats snapshot plus current profiler percentiles
+void stats_shm_publish(float nutrition, int fish_count, int plant_count,
+                       float temperature, int bleached_count);
+
+// Returns 1 when the monitor posted a new temperature since last poll
+int stats_shm_poll_temperature(float* out_temperature);
+
+#endif // STATS_SHM_H
@@ -0,0 +1,21 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// Streaming telemetry recorder. Activated with "--telemetry [file]" on
+// the command line: the simulation thread stages one compact metric
+// record per frame into a lock-free single-producer ring and a
+// background thread appends the records to a binary log, so complete
+// run histories are captured without perturbing the simulation.
+
+// Returns 1 when telemetry was requested on the command line
+int telemetry_parse_args(int argc, char* argv[]);
+
+int telemetry_init(void);
+void telemetry_cleanup(void);
+int telemetry_is_active(void);
+
+// Stage this frame's metrics into the ring; near-free on the
+// simulation thread
+void telemetry_record_frame(void);
+
+#endif // TELEMETRY_H
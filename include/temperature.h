@@ -1,7 +1,7 @@
 #ifndef TEMPERATURE_H
 #define TEMPERATURE_H
 
-#include <SDL2/SDL.h>
+#include <stdio.h>
 
 // Temperature system initialization and cleanup
 int temperature_init(void);
@@ -14,6 +14,12 @@ void temperature_set_current(float temp);
 // Coral bleaching system
 void temperature_process_coral_bleaching(void);
 int temperature_is_coral_bleached(int node_id);
+void temperature_move_bleach_state(int from_node, int to_node);
+
+// Snapshot support
+int temperature_snapshot_word_count(int node_count);
+void temperature_snapshot_write(unsigned int* dest, int word_count);
+void temperature_snapshot_restore(const unsigned int* bits, int word_count);
 
 // Stats file integration
 void temperature_write_to_stats_file(FILE* stats_file);
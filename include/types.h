@@ -3,6 +3,12 @@
 
 #include <math.h>
 
+// Headless builds compile without SDL; renderer handles stay opaque so
+// the layer module APIs keep their signatures
+#ifdef HEADLESS_BUILD
+typedef struct SDL_Renderer SDL_Renderer;
+#endif
+
 // Core window and simulation constants
 #define WINDOW_WIDTH 1700
 #define WINDOW_HEIGHT 900
@@ -46,6 +52,10 @@
 #define INITIAL_PLANT_COUNT 300
 #define INITIAL_FISH_COUNT 30
 
+// Neural network scheduling: native inference runs every frame, Python
+// training only every Nth frame
+#define PYTHON_UPDATE_INTERVAL 4
+
 // Aging and lifecycle
 #define TARGET_FPS 30
 #define DEATH_CHECK_INTERVAL 30
@@ -66,7 +76,6 @@
 
 // Spatial optimization
 #define GRID_SIZE 40.0f
-#define MAX_NODES_PER_CELL 200
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -150,16 +159,16 @@ typedef struct {
     int can_grow;
     int plant_type;     // -1 for fish, -2 for corpse, >=0 for plants
     int branch_count;
-    int age;
-    
+    int birth_frame;    // age is computed on demand from the frame counter
+
     // Corpse system
     int is_corpse;
-    int corpse_decay_timer;
+    int corpse_expiry_frame;   // absolute frame at which the corpse decays
     int original_fish_type;
     float corpse_heading;
-    
-    // Seed immunity (temporary protection from being eaten)
-    int seed_immunity_timer;
+
+    // Seed immunity: absolute frame until which the seed cannot be eaten
+    int seed_immunity_until;
     
     // Nutrition storage (per-plant nutrition value)
     float stored_nutrition;
@@ -204,7 +213,7 @@ typedef struct {
     int node1, node2;
     int active;
     int plant_type;
-    int age;
+    int birth_frame;    // age is computed on demand from the frame counter
     
     // Visual curve parameters
     float curve_strength;
@@ -218,10 +227,18 @@ typedef struct {
     float zoom;
 } Camera;
 
-// Spatial optimization grid
+// Spatial optimization grid. The main lane holds every node for the
+// physics pair scans; the corpse lane mirrors just the corpse nodes so
+// scavenging queries skip the plant bulk. Both lanes are grown on
+// demand by grid.c, so dense clusters and mass die-offs never silently
+// drop nodes and empty cells cost only the header.
 typedef struct {
-    int node_indices[MAX_NODES_PER_CELL];
+    int* node_indices;
     int count;
+    int capacity;
+    int* corpse_indices;
+    int corpse_count;
+    int corpse_capacity;
 } GridCell;
 
 #endif // TYPES_H
\ No newline at end of file
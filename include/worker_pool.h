@@ -0,0 +1,18 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+// Shared worker thread pool for parallel simulation stages
+int worker_pool_init(void);
+void worker_pool_cleanup(void);
+
+// Number of worker threads (1 when threading is unavailable)
+int worker_pool_get_thread_count(void);
+
+// Task callback: receives one work item index plus the caller's context
+typedef void (*WorkerTask)(int item_index, void* context);
+
+// Run task for item indices 0..item_count-1 across the pool, blocking
+// until all items are processed (runs serially if the pool is not up)
+void worker_pool_run(WorkerTask task, void* context, int item_count);
+
+#endif // WORKER_POOL_H
@@ -0,0 +1,204 @@
+// For clock_gettime under -std=c99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "types.h"
+#include "bench.h"
+#include "profiler.h"
+#include "simulation.h"
+#include "plants.h"
+#include "fish.h"
+
+// Default benchmark parameters (overridable on the command line)
+#define BENCH_DEFAULT_FRAMES 600
+#define BENCH_DEFAULT_SEED 42
+
+// Benchmark state
+static int g_active = 0;
+static unsigned int g_seed = BENCH_DEFAULT_SEED;
+static int g_frame_limit = BENCH_DEFAULT_FRAMES;
+static int g_frames_done = 0;
+static char g_scenario[32] = "mixed";
+
+// Per-stage totals in seconds, accumulated from the profiler each frame
+static double g_stage_total[PROF_STAGE_COUNT];
+static double g_run_start = 0.0;
+
+// Monotonic wall clock in seconds
+static double now_seconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+int bench_parse_args(int argc, char* argv[]) {
+    int bench_index = -1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            bench_index = i;
+            break;
+        }
+    }
+
+    if (bench_index < 0) {
+        return 0;
+    }
+
+    // Optional positional arguments: scenario, frame count, seed
+    if (bench_index + 1 < argc) {
+        strncpy(g_scenario, argv[bench_index + 1], sizeof(g_scenario) - 1);
+        g_scenario[sizeof(g_scenario) - 1] = '\0';
+    }
+    if (bench_index + 2 < argc) {
+        int frames = atoi(argv[bench_index + 2]);
+        if (frames > 0) g_frame_limit = frames;
+    }
+    if (bench_index + 3 < argc) {
+        g_seed = (unsigned int)strtoul(argv[bench_index + 3], NULL, 10);
+    }
+
+    if (strcmp(g_scenario, "plants") != 0 &&
+        strcmp(g_scenario, "fish") != 0 &&
+        strcmp(g_scenario, "mixed") != 0) {
+        printf("Unknown benchmark scenario '%s', using 'mixed'\n", g_scenario);
+        strcpy(g_scenario, "mixed");
+    }
+
+    // Propagate the seed into the embedded Python controller so its
+    // network initialization and exploration are reproducible too
+    char seed_str[16];
+    snprintf(seed_str, sizeof(seed_str), "%u", g_seed);
+#ifdef _WIN32
+    _putenv_s("TB_RANDOM_SEED", seed_str);
+#else
+    setenv("TB_RANDOM_SEED", seed_str, 1);
+#endif
+
+    g_active = 1;
+    return 1;
+}
+
+int bench_is_active(void) {
+    return g_active;
+}
+
+unsigned int bench_get_seed(void) {
+    return g_seed;
+}
+
+int bench_get_frame_limit(void) {
+    return g_frame_limit;
+}
+
+const char* bench_get_scenario_name(void) {
+    return g_scenario;
+}
+
+// Spawn a deterministic population; rand() is already seeded with the
+// benchmark seed so every run of the same scenario is identical
+void bench_setup_scenario(void) {
+    int plant_count;
+    int fish_count;
+
+    if (strcmp(g_scenario, "plants") == 0) {
+        plant_count = 100000;
+        fish_count = 1000;
+    } else if (strcmp(g_scenario, "fish") == 0) {
+        plant_count = 10000;
+        fish_count = 20000;
+    } else {
+        // mixed: 100k-node reef with an active fish population
+        plant_count = 90000;
+        fish_count = 10000;
+    }
+
+    int plant_species = plants_get_type_count();
+    int fish_species = fish_get_type_count();
+
+    printf("Benchmark scenario '%s': %d plants, %d fish (seed %u, %d frames)\n",
+           g_scenario, plant_count, fish_count, g_seed, g_frame_limit);
+
+    if (plant_species > 0) {
+        for (int i = 0; i < plant_count; i++) {
+            float x = WORLD_LEFT + ((float)rand() / RAND_MAX) * WORLD_WIDTH;
+            float y = WORLD_TOP + ((float)rand() / RAND_MAX) * WORLD_HEIGHT;
+            simulation_add_node(x, y, rand() % plant_species);
+        }
+    }
+
+    if (fish_species > 0) {
+        for (int i = 0; i < fish_count; i++) {
+            float x = WORLD_LEFT + ((float)rand() / RAND_MAX) * WORLD_WIDTH;
+            float y = WORLD_TOP + ((float)rand() / RAND_MAX) * WORLD_HEIGHT;
+            fish_add(x, y, rand() % fish_species);
+        }
+    }
+
+    printf("Benchmark population ready, starting timed run...\n");
+    g_run_start = now_seconds();
+}
+
+int bench_frame_done(void) {
+    // Fold the frame the profiler just finalized into the run totals
+    for (int i = 0; i < PROF_STAGE_COUNT; i++) {
+        g_stage_total[i] += (double)profiler_get_last_ms(i) / 1000.0;
+    }
+
+    g_frames_done++;
+    return g_frames_done >= g_frame_limit;
+}
+
+void bench_report(void) {
+    if (!g_active) return;
+
+    double wall = now_seconds() - g_run_start;
+    if (wall <= 0.0) wall = 1e-9;
+
+    // Nested stages are reported exclusively: gas runs inside
+    // plants_grow and vision inside fish_update
+    double exclusive[PROF_STAGE_COUNT];
+    memcpy(exclusive, g_stage_total, sizeof(exclusive));
+    exclusive[PROF_STAGE_PLANTS] -= g_stage_total[PROF_STAGE_GAS];
+    exclusive[PROF_STAGE_FISH] -= g_stage_total[PROF_STAGE_VISION];
+    if (exclusive[PROF_STAGE_PLANTS] < 0.0) exclusive[PROF_STAGE_PLANTS] = 0.0;
+    if (exclusive[PROF_STAGE_FISH] < 0.0) exclusive[PROF_STAGE_FISH] = 0.0;
+
+    printf("\n=== BENCHMARK REPORT ===\n");
+    printf("Scenario: %s, seed: %u\n", g_scenario, g_seed);
+    printf("Frames: %d, wall time: %.3f s, throughput: %.1f frames/sec\n",
+           g_frames_done, wall, (double)g_frames_done / wall);
+    printf("\n%-16s %10s %10s %7s\n", "stage", "total s", "ms/frame", "%wall");
+
+    double accounted = 0.0;
+    for (int i = 0; i < PROF_STAGE_COUNT; i++) {
+        if (exclusive[i] <= 0.0) continue;
+        printf("%-16s %10.3f %10.3f %6.1f%%\n",
+               profiler_get_stage_name(i), exclusive[i],
+               exclusive[i] * 1000.0 / (double)g_frames_done,
+               exclusive[i] * 100.0 / wall);
+        accounted += exclusive[i];
+    }
+
+    double other = wall - accounted;
+    if (other < 0.0) other = 0.0;
+    printf("%-16s %10.3f %10.3f %6.1f%%\n",
+           "other", other, other * 1000.0 / (double)g_frames_done,
+           other * 100.0 / wall);
+    printf("========================\n\n");
+}
@@ -0,0 +1,251 @@
+// For setenv and the process APIs under -std=c99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#include "farm.h"
+
+// Default worker frame budget (overridable on the command line).
+// Training runs need far more frames than a benchmark, so the default
+// is sized for meaningful reproduction cycles.
+#define FARM_DEFAULT_FRAMES 20000
+#define FARM_MAX_WORKERS 64
+
+// Farm state
+static int g_is_parent = 0;
+static int g_is_worker = 0;
+static int g_worker_count = 0;
+static int g_worker_id = -1;
+static int g_frame_limit = FARM_DEFAULT_FRAMES;
+static unsigned int g_seed = 0;
+static int g_frames_done = 0;
+
+int farm_parse_args(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--farm") == 0) {
+            if (i + 1 >= argc) {
+                printf("--farm requires a worker count\n");
+                return 0;
+            }
+            g_worker_count = atoi(argv[i + 1]);
+            if (g_worker_count < 1) g_worker_count = 1;
+            if (g_worker_count > FARM_MAX_WORKERS) g_worker_count = FARM_MAX_WORKERS;
+            if (i + 2 < argc) {
+                int frames = atoi(argv[i + 2]);
+                if (frames > 0) g_frame_limit = frames;
+            }
+            g_is_parent = 1;
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--farm-worker") == 0) {
+            if (i + 3 >= argc) {
+                printf("--farm-worker requires id, frames and seed\n");
+                return 0;
+            }
+            g_worker_id = atoi(argv[i + 1]);
+            g_frame_limit = atoi(argv[i + 2]);
+            g_seed = (unsigned int)strtoul(argv[i + 3], NULL, 10);
+            if (g_frame_limit < 1) g_frame_limit = FARM_DEFAULT_FRAMES;
+
+            // The controller script reads this to suffix its model
+            // output files, so workers never clobber each other
+            char suffix[32];
+            snprintf(suffix, sizeof(suffix), "_w%d", g_worker_id);
+#ifdef _WIN32
+            _putenv_s("TB_MODEL_SUFFIX", suffix);
+#else
+            setenv("TB_MODEL_SUFFIX", suffix, 1);
+#endif
+            g_is_worker = 1;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int farm_is_parent(void) {
+    return g_is_parent;
+}
+
+int farm_is_worker(void) {
+    return g_is_worker;
+}
+
+unsigned int farm_get_seed(void) {
+    return g_seed;
+}
+
+int farm_frame_done(void) {
+    g_frames_done++;
+    if (g_frames_done < g_frame_limit) return 0;
+
+    printf("Farm worker %d finished %d frames\n", g_worker_id, g_frames_done);
+    return 1;
+}
+
+// Extract the performance score the controller script embeds in each
+// saved model. Returns 1 on success.
+static int read_model_score(const char* filename, float* out_score) {
+    FILE* fp = fopen(filename, "r");
+    if (!fp) return 0;
+
+    char buffer[512];
+    int found = 0;
+    while (fgets(buffer, sizeof(buffer), fp)) {
+        char* key = strstr(buffer, "\"performance_score\"");
+        if (!key) continue;
+        char* colon = strchr(key, ':');
+        if (!colon) continue;
+        *out_score = (float)strtod(colon + 1, NULL);
+        found = 1;
+        break;
+    }
+
+    fclose(fp);
+    return found;
+}
+
+// Copy a worker's model file over the canonical filename
+static int copy_model_file(const char* src, const char* dst) {
+    FILE* in = fopen(src, "rb");
+    if (!in) return 0;
+
+    FILE* out = fopen(dst, "wb");
+    if (!out) {
+        fclose(in);
+        return 0;
+    }
+
+    char buffer[4096];
+    size_t bytes;
+    while ((bytes = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+        fwrite(buffer, 1, bytes, out);
+    }
+
+    fclose(in);
+    fclose(out);
+    return 1;
+}
+
+// Pick the best-scoring worker model for one species and promote it to
+// the canonical filename the simulation expects
+static void merge_species_models(const char* species) {
+    char filename[128];
+    char best_filename[128];
+    float best_score = 0.0f;
+    int best_found = 0;
+
+    for (int k = 0; k < g_worker_count; k++) {
+        snprintf(filename, sizeof(filename), "best_%s_model_w%d.json", species, k);
+
+        float score;
+        if (!read_model_score(filename, &score)) continue;
+
+        if (!best_found || score > best_score) {
+            best_score = score;
+            best_found = 1;
+            strcpy(best_filename, filename);
+        }
+    }
+
+    if (!best_found) {
+        printf("Farm merge: no %s models saved by any worker\n", species);
+        return;
+    }
+
+    snprintf(filename, sizeof(filename), "best_%s_model.json", species);
+    if (copy_model_file(best_filename, filename)) {
+        printf("Farm merge: %s -> %s (score %.1f)\n", best_filename, filename, best_score);
+    } else {
+        printf("Farm merge: failed to copy %s\n", best_filename);
+    }
+}
+
+int farm_run_parent(const char* exe_path) {
+    unsigned int base_seed = (unsigned int)time(NULL);
+
+    printf("Farm mode: spawning %d workers, %d frames each\n",
+           g_worker_count, g_frame_limit);
+
+#ifdef _WIN32
+    HANDLE processes[FARM_MAX_WORKERS];
+    int spawned = 0;
+
+    for (int k = 0; k < g_worker_count; k++) {
+        char command[512];
+        snprintf(command, sizeof(command), "\"%s\" --farm-worker %d %d %u",
+                 exe_path, k, g_frame_limit, base_seed + (unsigned int)k);
+
+        STARTUPINFOA si;
+        PROCESS_INFORMATION pi;
+        memset(&si, 0, sizeof(si));
+        si.cb = sizeof(si);
+        memset(&pi, 0, sizeof(pi));
+
+        if (!CreateProcessA(NULL, command, NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi)) {
+            printf("Failed to spawn farm worker %d\n", k);
+            continue;
+        }
+        CloseHandle(pi.hThread);
+        processes[spawned++] = pi.hProcess;
+        printf("Spawned farm worker %d (seed %u)\n", k, base_seed + (unsigned int)k);
+    }
+
+    for (int k = 0; k < spawned; k++) {
+        WaitForSingleObject(processes[k], INFINITE);
+        CloseHandle(processes[k]);
+    }
+#else
+    pid_t pids[FARM_MAX_WORKERS];
+    int spawned = 0;
+
+    for (int k = 0; k < g_worker_count; k++) {
+        char id_arg[16], frames_arg[16], seed_arg[16];
+        snprintf(id_arg, sizeof(id_arg), "%d", k);
+        snprintf(frames_arg, sizeof(frames_arg), "%d", g_frame_limit);
+        snprintf(seed_arg, sizeof(seed_arg), "%u", base_seed + (unsigned int)k);
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            printf("Failed to spawn farm worker %d\n", k);
+            continue;
+        }
+        if (pid == 0) {
+            execl(exe_path, exe_path, "--farm-worker",
+                  id_arg, frames_arg, seed_arg, (char*)NULL);
+            perror("execl");
+            _exit(127);
+        }
+        pids[spawned++] = pid;
+        printf("Spawned farm worker %d (seed %u)\n", k, base_seed + (unsigned int)k);
+    }
+
+    for (int k = 0; k < spawned; k++) {
+        int status;
+        waitpid(pids[k], &status, 0);
+    }
+#endif
+
+    if (spawned == 0) {
+        printf("Farm mode: no workers could be spawned\n");
+        return 1;
+    }
+
+    printf("All %d farm workers finished, merging models...\n", spawned);
+    merge_species_models("herbivore");
+    merge_species_models("predator");
+
+    return 0;
+}
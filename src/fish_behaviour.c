@@ -4,6 +4,7 @@
 
 #include "types.h"
 #include "fish.h"
+#include "fish_grid.h"
 #include "simulation.h"
 #include "grid.h"
 #include "plants.h"
@@ -361,7 +362,7 @@ int fish_attempt_eating_plant(int fish_id) {
             if (nodes[node_id].plant_type == -1) continue;
             if (nodes[node_id].is_corpse) continue;
             
-            if (nodes[node_id].seed_immunity_timer > 0) {
+            if (simulation_is_seed_immune(node_id)) {
                 continue;
             }
             
@@ -396,11 +397,11 @@ int fish_attempt_eating_plant(int fish_id) {
             float eating_reward = nutrition_value * 40.0f;
             fish->last_reward += eating_reward;
             
-            nodes[node_id].active = 0;
             nodes[node_id].can_grow = 0;
-            
+            simulation_remove_node(node_id);
+
             fish->last_eating_frame = simulation_get_frame_counter();
-            
+
             return 1;
         }
     }
@@ -423,42 +424,53 @@ int fish_attempt_eating_fish(int fish_id) {
     Node* nodes = simulation_get_nodes();
     Node* fish_node = &nodes[fish->node_id];
     Fish* all_fish = fish_get_all();
-    int fish_count = fish_get_count();
-    
+
     float fish_x = fish_node->x;
     float fish_y = fish_node->y;
     float eating_range_sq = fish_type->eating_range * fish_type->eating_range;
-    
-    for (int i = 0; i < fish_count; i++) {
-        if (!all_fish[i].active) continue;
-        if (i == fish_id) continue;
-        if (all_fish[i].fish_type == fish->fish_type) continue;
-        
-        FishType* prey_type = fish_get_type(all_fish[i].fish_type);
-        if (!prey_type) continue;
-        
-        if (prey_type->danger_level >= fish_type->danger_level) continue;
-        
-        Node* prey_node = &nodes[all_fish[i].node_id];
-        if (!prey_node->active) continue;
-        
-        float dx = prey_node->x - fish_x;
-        float dy = prey_node->y - fish_y;
-        float distance_sq = dx * dx + dy * dy;
-        
-        if (distance_sq <= eating_range_sq) {
-            float predation_reward = 35.0f + (fish_type->danger_level * 15.0f);
-            fish->last_reward += predation_reward;
-            
-            all_fish[i].active = 0;
-            prey_node->active = 0;
-            
-            fish->eating_cooldown = fish_type->eating_cooldown_frames;
-            
-            return 1;
+
+    // Walk the fish grid directly: its cells hold fish ids, so predation
+    // never skip-tests the plant-dominated node grid
+    int grid_x, grid_y;
+    fish_grid_world_to_coords(fish_x, fish_y, &grid_x, &grid_y);
+    int cell_radius = (int)(fish_type->eating_range / FISH_GRID_SIZE) + 1;
+
+    for (int gy = grid_y - cell_radius; gy <= grid_y + cell_radius; gy++) {
+        for (int gx = grid_x - cell_radius; gx <= grid_x + cell_radius; gx++) {
+            for (int prey_id = fish_grid_cell_head(gx, gy); prey_id >= 0;
+                 prey_id = fish_grid_next(prey_id)) {
+                if (prey_id == fish_id) continue;
+                if (!all_fish[prey_id].active) continue;
+                if (all_fish[prey_id].fish_type == fish->fish_type) continue;
+
+                FishType* prey_type = fish_get_type(all_fish[prey_id].fish_type);
+                if (!prey_type) continue;
+
+                if (prey_type->danger_level >= fish_type->danger_level) continue;
+
+                int node_id = all_fish[prey_id].node_id;
+                if (node_id < 0 || node_id >= simulation_get_node_count()) continue;
+                if (!nodes[node_id].active) continue;
+
+                float dx = nodes[node_id].x - fish_x;
+                float dy = nodes[node_id].y - fish_y;
+                float distance_sq = dx * dx + dy * dy;
+
+                if (distance_sq <= eating_range_sq) {
+                    float predation_reward = 35.0f + (fish_type->danger_level * 15.0f);
+                    fish->last_reward += predation_reward;
+
+                    all_fish[prey_id].active = 0;
+                    simulation_remove_node(node_id);
+
+                    fish->eating_cooldown = fish_type->eating_cooldown_frames;
+
+                    return 1;
+                }
+            }
         }
     }
-    
+
     return 0;
 }
 
@@ -482,13 +494,13 @@ int fish_attempt_eating_corpse(int fish_id) {
     for (int c = 0; c < cell_count; c++) {
         GridCell* cell = cells[c];
         if (!cell) continue;
-        
-        for (int k = 0; k < cell->count; k++) {
-            int node_id = cell->node_indices[k];
+
+        // Corpse lane only: no need to skip-test the plant population
+        for (int k = 0; k < cell->corpse_count; k++) {
+            int node_id = cell->corpse_indices[k];
             if (node_id < 0 || node_id >= simulation_get_node_count()) continue;
             if (!nodes[node_id].active) continue;
-            if (!nodes[node_id].is_corpse) continue;
-            
+
             float dx = nodes[node_id].x - fish_x;
             float dy = nodes[node_id].y - fish_y;
             float distance_sq = dx * dx + dy * dy;
@@ -503,8 +515,8 @@ int fish_attempt_eating_corpse(int fish_id) {
                 float eating_reward = nutrition_value * 35.0f;
                 fish->last_reward += eating_reward;
                 
-                nodes[node_id].active = 0;
-                
+                simulation_remove_node(node_id);
+
                 fish->last_eating_frame = simulation_get_frame_counter();
                 fish_increment_corpses_eaten();
                 
@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "types.h"
+#include "fish_brain.h"
+#include "fish.h"
+
+// Per-fish network weights, mirrored from the Python brains. Python
+// pushes updated weights after each training pass; inference runs here
+// every frame without touching the interpreter.
+typedef struct {
+    float w1[RL_INPUT_SIZE * FISH_BRAIN_HIDDEN_SIZE];
+    float b1[FISH_BRAIN_HIDDEN_SIZE];
+    float w2[FISH_BRAIN_HIDDEN_SIZE * RL_OUTPUT_SIZE];
+    float b2[RL_OUTPUT_SIZE];
+    float exploration_rate;
+    int loaded;
+} FishBrainWeights;
+
+static FishBrainWeights* g_weights = NULL;
+
+// Action momentum, matching choose_action() in fish_controller.py
+#define BRAIN_MOMENTUM 0.15f
+
+int fish_brain_init(void) {
+    g_weights = (FishBrainWeights*)calloc(MAX_FISH, sizeof(FishBrainWeights));
+
+    if (!g_weights) {
+        printf("Failed to allocate fish brain weights\n");
+        return 0;
+    }
+
+    printf("Fish brain inference engine initialized (%dx%dx%d networks)\n",
+           RL_INPUT_SIZE, FISH_BRAIN_HIDDEN_SIZE, RL_OUTPUT_SIZE);
+    return 1;
+}
+
+void fish_brain_cleanup(void) {
+    if (g_weights) {
+        free(g_weights);
+        g_weights = NULL;
+    }
+}
+
+void fish_brain_set_weights(int fish_id, const float* w1, const float* b1,
+                            const float* w2, const float* b2,
+                            float exploration_rate) {
+    if (!g_weights || fish_id < 0 || fish_id >= MAX_FISH) return;
+
+    FishBrainWeights* brain = &g_weights[fish_id];
+    memcpy(brain->w1, w1, sizeof(brain->w1));
+    memcpy(brain->b1, b1, sizeof(brain->b1));
+    memcpy(brain->w2, w2, sizeof(brain->w2));
+    memcpy(brain->b2, b2, sizeof(brain->b2));
+    brain->exploration_rate = exploration_rate;
+    brain->loaded = 1;
+}
+
+void fish_brain_clear(int fish_id) {
+    if (!g_weights || fish_id < 0 || fish_id >= MAX_FISH) return;
+    g_weights[fish_id].loaded = 0;
+}
+
+int fish_brain_is_loaded(int fish_id) {
+    if (!g_weights || fish_id < 0 || fish_id >= MAX_FISH) return 0;
+    return g_weights[fish_id].loaded;
+}
+
+static float clamped_sigmoid(float x) {
+    if (x > 500.0f) x = 500.0f;
+    if (x < -500.0f) x = -500.0f;
+    return 1.0f / (1.0f + expf(-x));
+}
+
+static float clamped_tanh(float x) {
+    if (x > 10.0f) x = 10.0f;
+    if (x < -10.0f) x = -10.0f;
+    return tanhf(x);
+}
+
+// Forward pass for one fish, mirroring forward() in fish_controller.py:
+// clamped input normalization, leaky ReLU hidden layer, tanh/sigmoid
+// output activations
+static void run_forward_pass(FishBrainWeights* brain, const float* inputs, float* action) {
+    float normalized[RL_INPUT_SIZE];
+    float hidden[FISH_BRAIN_HIDDEN_SIZE];
+
+    // Normalize inputs: target/oxygen channels to [-1,1], threat to [-2,2]
+    for (int j = 0; j < RL_INPUT_SIZE; j++) {
+        float limit = (j < 4) ? 1.0f : 2.0f;
+        float v = inputs[j];
+        if (v > limit) v = limit;
+        if (v < -limit) v = -limit;
+        normalized[j] = v;
+    }
+
+#ifdef __SSE2__
+    // Hidden layer: accumulate 4 hidden units per lane
+    for (int i = 0; i + 4 <= FISH_BRAIN_HIDDEN_SIZE; i += 4) {
+        __m128 sum = _mm_loadu_ps(&brain->b1[i]);
+
+        for (int j = 0; j < RL_INPUT_SIZE; j++) {
+            __m128 in = _mm_set1_ps(normalized[j]);
+            __m128 w = _mm_loadu_ps(&brain->w1[j * FISH_BRAIN_HIDDEN_SIZE + i]);
+            sum = _mm_add_ps(sum, _mm_mul_ps(in, w));
+        }
+
+        // Leaky ReLU: max(0.1 * x, x)
+        __m128 leak = _mm_mul_ps(sum, _mm_set1_ps(0.1f));
+        _mm_storeu_ps(&hidden[i], _mm_max_ps(leak, sum));
+    }
+
+    // Scalar tail in case the hidden width stops being a multiple of 4
+    for (int i = (FISH_BRAIN_HIDDEN_SIZE / 4) * 4; i < FISH_BRAIN_HIDDEN_SIZE; i++) {
+        float sum = brain->b1[i];
+        for (int j = 0; j < RL_INPUT_SIZE; j++) {
+            sum += normalized[j] * brain->w1[j * FISH_BRAIN_HIDDEN_SIZE + i];
+        }
+        hidden[i] = (sum > 0.0f) ? sum : 0.1f * sum;
+    }
+#else
+    for (int i = 0; i < FISH_BRAIN_HIDDEN_SIZE; i++) {
+        float sum = brain->b1[i];
+        for (int j = 0; j < RL_INPUT_SIZE; j++) {
+            sum += normalized[j] * brain->w1[j * FISH_BRAIN_HIDDEN_SIZE + i];
+        }
+        hidden[i] = (sum > 0.0f) ? sum : 0.1f * sum;
+    }
+#endif
+
+    float outputs[RL_OUTPUT_SIZE];
+    for (int i = 0; i < RL_OUTPUT_SIZE; i++) {
+        float sum = brain->b2[i];
+        for (int j = 0; j < FISH_BRAIN_HIDDEN_SIZE; j++) {
+            sum += hidden[j] * brain->w2[j * RL_OUTPUT_SIZE + i];
+        }
+        outputs[i] = sum;
+    }
+
+    action[0] = clamped_tanh(outputs[0]);
+    action[1] = clamped_sigmoid(outputs[1]);
+    action[2] = clamped_sigmoid(outputs[2]);
+}
+
+void fish_brain_update(void) {
+    if (!g_weights) return;
+
+    Fish* all_fish = fish_get_all();
+
+    // Slots are sparse, so cover every used slot, not just the first
+    // active-count entries
+    int slot_count = fish_get_highest_slot() + 1;
+
+    for (int i = 0; i < slot_count; i++) {
+        if (!all_fish[i].active) continue;
+        if (!g_weights[i].loaded) continue;
+
+        FishBrainWeights* brain = &g_weights[i];
+        float action[RL_OUTPUT_SIZE];
+
+        // Exploration: occasionally take a random action, like Python
+        if ((float)rand() / RAND_MAX < brain->exploration_rate) {
+            action[0] = ((float)rand() / RAND_MAX) * 2.0f - 1.0f;
+            action[1] = 0.3f + ((float)rand() / RAND_MAX) * 0.7f;
+            action[2] = (float)rand() / RAND_MAX;
+        } else {
+            run_forward_pass(brain, all_fish[i].rl_inputs, action);
+        }
+
+        // Blend with the previous action for temporal consistency
+        for (int k = 0; k < RL_OUTPUT_SIZE; k++) {
+            action[k] = (1.0f - BRAIN_MOMENTUM) * action[k] +
+                        BRAIN_MOMENTUM * all_fish[i].rl_outputs[k];
+        }
+
+        // Clamp to valid action ranges
+        if (action[0] < -1.0f) action[0] = -1.0f;
+        if (action[0] > 1.0f) action[0] = 1.0f;
+        if (action[1] < 0.0f) action[1] = 0.0f;
+        if (action[1] > 1.0f) action[1] = 1.0f;
+        if (action[2] < 0.0f) action[2] = 0.0f;
+        if (action[2] > 1.0f) action[2] = 1.0f;
+
+        all_fish[i].rl_outputs[0] = action[0];
+        all_fish[i].rl_outputs[1] = action[1];
+        all_fish[i].rl_outputs[2] = action[2];
+    }
+}
@@ -5,10 +5,18 @@
 
 #include "types.h"
 #include "fish.h"
+#include "fish_grid.h"
+#include "fish_brain.h"
 #include "simulation.h"
+#include "lazy_alloc.h"
 
 // Global fish system state
 static Fish* g_fish = NULL;
+
+// Reverse index node_id -> fish_id (stored as fish_id + 1, 0 = no fish).
+// Lazily committed so the full node range costs nothing until populated.
+static LazyBuffer g_node_fish_buffer;
+static int* g_node_fish = NULL;
 static FishType g_fish_types[MAX_FISH_TYPES];
 static int g_fish_type_count = 0;
 static int g_ray_rendering_enabled = 0;
@@ -50,6 +58,18 @@ static void update_fish_tracking(void) {
     }
 }
 
+static void set_node_fish(int node_id, int fish_id) {
+    if (node_id < 0 || !g_node_fish) return;
+    if (!lazy_buffer_ensure(&g_node_fish_buffer, (size_t)node_id + 1)) return;
+    g_node_fish[node_id] = fish_id + 1;
+}
+
+static void clear_node_fish(int node_id) {
+    if (node_id < 0 || !g_node_fish) return;
+    if ((size_t)node_id >= g_node_fish_buffer.committed) return;
+    g_node_fish[node_id] = 0;
+}
+
 // Validate fish ID and return fish pointer
 static Fish* get_validated_fish(int fish_id) {
     if (fish_id < 0 || fish_id >= MAX_FISH) {
@@ -72,7 +92,7 @@ static int create_corpse(int fish_id, float x, float y, int fish_type, float hea
     Node* corpse = &nodes[corpse_node];
     
     corpse->is_corpse = 1;
-    corpse->corpse_decay_timer = CORPSE_DECAY_TIME;
+    corpse->corpse_expiry_frame = simulation_get_frame_counter() + CORPSE_DECAY_TIME;
     corpse->original_fish_type = fish_type;
     corpse->corpse_heading = heading;
     corpse->vx = 0.0f;
@@ -94,7 +114,24 @@ int fish_init(void) {
         printf("Failed to allocate memory for fish\n");
         return 0;
     }
-    
+
+    if (!lazy_buffer_init(&g_node_fish_buffer, sizeof(int), MAX_NODES)) {
+        printf("Failed to allocate node-to-fish lookup\n");
+        free(g_fish);
+        g_fish = NULL;
+        return 0;
+    }
+    g_node_fish = (int*)g_node_fish_buffer.base;
+
+    if (!fish_grid_init()) {
+        printf("Failed to initialize fish spatial index\n");
+        lazy_buffer_cleanup(&g_node_fish_buffer);
+        g_node_fish = NULL;
+        free(g_fish);
+        g_fish = NULL;
+        return 0;
+    }
+
     // Initialize all fish as inactive
     for (int i = 0; i < MAX_FISH; i++) {
         g_fish[i].active = 0;
@@ -122,7 +159,12 @@ void fish_cleanup(void) {
         free(g_fish);
         g_fish = NULL;
     }
-    
+
+    lazy_buffer_cleanup(&g_node_fish_buffer);
+    g_node_fish = NULL;
+
+    fish_grid_cleanup();
+
     printf("Fish cleanup - Active: %d, Deaths: %d, Corpses created: %d, Corpses eaten: %d\n",
            g_active_fish_count, g_total_deaths_from_age, g_total_corpses_created, g_total_corpses_eaten);
     printf("Nutrition - Consumed: %.2f, Defecated: %.2f, Balance: %.2f\n",
@@ -345,6 +387,9 @@ int fish_add(float x, float y, int fish_type) {
     // Initialize fish in found slot
     Fish* fish = &g_fish[fish_id];
     memset(fish, 0, sizeof(Fish));
+
+    // Drop any native network weights left by the slot's previous owner
+    fish_brain_clear(fish_id);
     
     // Set core data
     fish->active = 1;
@@ -373,7 +418,10 @@ int fish_add(float x, float y, int fish_type) {
     fish->eating_cooldown = 0;
     fish->target_fish_id = -1;
     fish->birth_frame = simulation_get_frame_counter();
-    
+
+    // Register in the node-to-fish reverse index
+    set_node_fish(node_id, fish_id);
+
     // Update tracking
     update_fish_tracking();
     
@@ -397,11 +445,11 @@ void fish_remove(int fish_id) {
     printf("Removing fish %d (%s)\n", fish_id, ft ? ft->name : "Unknown");
     
     // Deactivate simulation node
-    Node* nodes = simulation_get_nodes();
     if (fish->node_id >= 0 && fish->node_id < simulation_get_node_count()) {
-        nodes[fish->node_id].active = 0;
+        simulation_remove_node(fish->node_id);
     }
-    
+    clear_node_fish(fish->node_id);
+
     // Clear fish data
     fish->active = 0;
     fish->node_id = -1;
@@ -491,6 +539,65 @@ Fish* fish_get_all(void) {
     return g_fish;
 }
 
+// O(1) reverse lookup: which fish owns this node? Returns -1 if none.
+// Entries can go stale when a fish dies without fish_remove(), so the
+// owning fish is verified before the ID is handed out.
+int fish_get_id_by_node(int node_id) {
+    if (node_id < 0 || !g_node_fish) return -1;
+    if ((size_t)node_id >= g_node_fish_buffer.committed) return -1;
+
+    int fish_id = g_node_fish[node_id] - 1;
+    if (fish_id < 0 || fish_id >= MAX_FISH) return -1;
+    if (!g_fish[fish_id].active || g_fish[fish_id].node_id != node_id) {
+        return -1;
+    }
+    return fish_id;
+}
+
+Fish* fish_get_by_node(int node_id) {
+    int fish_id = fish_get_id_by_node(node_id);
+    return (fish_id >= 0) ? &g_fish[fish_id] : NULL;
+}
+
+// Rebuild the reverse index after node indices change (compaction)
+void fish_refresh_node_lookup(void) {
+    if (!g_node_fish) return;
+
+    memset(g_node_fish, 0, g_node_fish_buffer.committed * sizeof(int));
+
+    for (int i = 0; i <= g_highest_used_slot; i++) {
+        if (g_fish[i].active) {
+            set_node_fish(g_fish[i].node_id, i);
+        }
+    }
+}
+
+// Replace the fish population with snapshot data and rebuild the
+// derived counters and the node reverse lookup
+void fish_snapshot_restore(const Fish* fish, int count) {
+    if (!g_fish) return;
+    if (count < 0) count = 0;
+    if (count > MAX_FISH) count = MAX_FISH;
+
+    memcpy(g_fish, fish, (size_t)count * sizeof(Fish));
+    for (int i = count; i < MAX_FISH; i++) {
+        g_fish[i].active = 0;
+        g_fish[i].node_id = -1;
+        g_fish[i].fish_type = -1;
+    }
+
+    g_active_fish_count = 0;
+    g_highest_used_slot = -1;
+    for (int i = 0; i < count; i++) {
+        if (g_fish[i].active) {
+            g_active_fish_count++;
+            g_highest_used_slot = i;
+        }
+    }
+
+    fish_refresh_node_lookup();
+}
+
 int fish_get_type_count(void) {
     return g_fish_type_count;
 }
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "types.h"
+#include "fish_grid.h"
+#include "fish.h"
+#include "simulation.h"
+
+// Per-cell fish lists stored as intrusive chains: g_cell_head holds the
+// first fish id per cell and g_fish_next links fish sharing a cell, so
+// rebuilds are O(fish) with no per-cell capacity limit.
+static int* g_cell_head = NULL;
+static int* g_fish_next = NULL;
+static int g_grid_width = 0;
+static int g_grid_height = 0;
+
+int fish_grid_init(void) {
+    g_grid_width = (int)ceil(WORLD_WIDTH / FISH_GRID_SIZE);
+    g_grid_height = (int)ceil(WORLD_HEIGHT / FISH_GRID_SIZE);
+
+    g_cell_head = (int*)malloc(g_grid_width * g_grid_height * sizeof(int));
+
+    if (!g_cell_head) {
+        printf("Failed to allocate fish grid cells\n");
+        return 0;
+    }
+
+    g_fish_next = (int*)malloc(MAX_FISH * sizeof(int));
+
+    if (!g_fish_next) {
+        printf("Failed to allocate fish grid chains\n");
+        free(g_cell_head);
+        g_cell_head = NULL;
+        return 0;
+    }
+
+    for (int i = 0; i < g_grid_width * g_grid_height; i++) {
+        g_cell_head[i] = -1;
+    }
+
+    printf("Fish grid initialized: %dx%d cells\n", g_grid_width, g_grid_height);
+    return 1;
+}
+
+void fish_grid_cleanup(void) {
+    if (g_cell_head) {
+        free(g_cell_head);
+        g_cell_head = NULL;
+    }
+    if (g_fish_next) {
+        free(g_fish_next);
+        g_fish_next = NULL;
+    }
+}
+
+static void world_to_grid(float world_x, float world_y, int* grid_x, int* grid_y) {
+    *grid_x = (int)floor((world_x - WORLD_LEFT) / FISH_GRID_SIZE);
+    *grid_y = (int)floor((world_y - WORLD_TOP) / FISH_GRID_SIZE);
+}
+
+void fish_grid_rebuild(void) {
+    if (!g_cell_head) return;
+
+    for (int i = 0; i < g_grid_width * g_grid_height; i++) {
+        g_cell_head[i] = -1;
+    }
+
+    Node* nodes = simulation_get_nodes();
+    int node_count = simulation_get_node_count();
+    Fish* all_fish = fish_get_all();
+    int highest_slot = fish_get_highest_slot();
+
+    for (int i = 0; i <= highest_slot; i++) {
+        if (!all_fish[i].active) continue;
+
+        int node_id = all_fish[i].node_id;
+        if (node_id < 0 || node_id >= node_count) continue;
+        if (!nodes[node_id].active) continue;
+
+        int grid_x, grid_y;
+        world_to_grid(nodes[node_id].x, nodes[node_id].y, &grid_x, &grid_y);
+
+        if (grid_x < 0) grid_x = 0;
+        if (grid_x >= g_grid_width) grid_x = g_grid_width - 1;
+        if (grid_y < 0) grid_y = 0;
+        if (grid_y >= g_grid_height) grid_y = g_grid_height - 1;
+
+        int linear = grid_y * g_grid_width + grid_x;
+        g_fish_next[i] = g_cell_head[linear];
+        g_cell_head[linear] = i;
+    }
+}
+
+int fish_grid_cell_head(int grid_x, int grid_y) {
+    if (!g_cell_head) return -1;
+    if (grid_x < 0 || grid_x >= g_grid_width ||
+        grid_y < 0 || grid_y >= g_grid_height) {
+        return -1;
+    }
+    return g_cell_head[grid_y * g_grid_width + grid_x];
+}
+
+int fish_grid_next(int fish_id) {
+    if (!g_fish_next || fish_id < 0 || fish_id >= MAX_FISH) return -1;
+    return g_fish_next[fish_id];
+}
+
+int fish_grid_get_width(void) {
+    return g_grid_width;
+}
+
+int fish_grid_get_height(void) {
+    return g_grid_height;
+}
+
+void fish_grid_world_to_coords(float world_x, float world_y, int* grid_x, int* grid_y) {
+    world_to_grid(world_x, world_y, grid_x, grid_y);
+}
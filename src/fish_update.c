@@ -4,35 +4,61 @@
 
 #include "types.h"
 #include "fish.h"
+#include "fish_grid.h"
 #include "simulation.h"
 #include "flow.h"
+#include "profiler.h"
+#include "worker_pool.h"
 
 // Forward declaration for efficient iteration
 int fish_get_highest_slot(void);
 
+// Fish ids per worker item for the parallel sensing pass; coarse chunks
+// keep the pool's dispatch overhead negligible against the vision cost
+#define SENSE_CHUNK_SIZE 64
+
+typedef struct {
+    const int* fish_ids;
+    int fish_count;
+} SenseBatch;
+
+// Fill rl_inputs for one chunk of the sensing batch. Sensing only reads
+// the node grid, fish grid and environment layers and writes the fish's
+// own rl_inputs, so chunks are independent.
+static void sense_chunk_task(int chunk_index, void* context) {
+    SenseBatch* batch = (SenseBatch*)context;
+    int start = chunk_index * SENSE_CHUNK_SIZE;
+    int end = start + SENSE_CHUNK_SIZE;
+    if (end > batch->fish_count) end = batch->fish_count;
+
+    for (int n = start; n < end; n++) {
+        fish_update_rl_inputs(batch->fish_ids[n]);
+    }
+}
+
 // Update corpse decay system
 void fish_update_corpses(void) {
     Node* nodes = simulation_get_nodes();
-    int node_count = simulation_get_node_count();
+    int current_frame = simulation_get_frame_counter();
     int corpses_decayed = 0;
-    
-    for (int i = 0; i < node_count; i++) {
+
+    // Iterate the corpse registry instead of the full node array.
+    // Backwards, because removing a corpse swap-removes its registry
+    // entry: the element pulled into our slot was already visited.
+    const int* corpse_ids = simulation_get_corpse_ids();
+    for (int idx = simulation_get_corpse_count() - 1; idx >= 0; idx--) {
+        int i = corpse_ids[idx];
         if (!nodes[i].active) continue;
-        if (!nodes[i].is_corpse) continue;
-        
-        // Countdown decay timer
-        nodes[i].corpse_decay_timer--;
-        
-        // Remove corpse when timer expires
-        if (nodes[i].corpse_decay_timer <= 0) {
-            nodes[i].active = 0;
+
+        // Expiry is an absolute frame, so no per-corpse countdown write
+        if (current_frame >= nodes[i].corpse_expiry_frame) {
+            simulation_remove_node(i);
             corpses_decayed++;
         }
     }
     
     // Periodic debug output for corpse decay
     static int last_corpse_log = 0;
-    int current_frame = simulation_get_frame_counter();
     if (corpses_decayed > 0 && (current_frame - last_corpse_log) > 300) {
         printf("Corpse decay: %d corpses naturally decayed\n", corpses_decayed);
         last_corpse_log = current_frame;
@@ -50,7 +76,12 @@ void fish_update(void) {
     
     // Update corpse decay system
     fish_update_corpses();
-    
+
+    // Refresh the fish spatial index before the sensing pass
+    profiler_stage_begin(PROF_STAGE_VISION);
+    fish_grid_rebuild();
+    profiler_stage_end(PROF_STAGE_VISION);
+
     // Track frame statistics
     int deaths_this_frame = 0;
     int validation_errors = 0;
@@ -60,57 +91,78 @@ void fish_update(void) {
     int highest_slot = fish_get_highest_slot();
     int iteration_limit = (highest_slot >= 0) ? (highest_slot + 1) : 0;
     
+    // Pass 1 (serial): validation and death checks mutate shared state,
+    // then surviving fish are collected into the sensing batch
+    static int sense_batch[MAX_FISH];
+    int batch_count = 0;
+
     for (int i = 0; i < iteration_limit; i++) {
         // Skip inactive fish slots
         if (!fish_array[i].active) continue;
-        
+
         Fish* fish = &fish_array[i];
         int node_id = fish->node_id;
-        
+
         // Validate node ID to prevent crashes
         if (node_id < 0 || node_id >= node_count) {
-            printf("ERROR: Fish %d has invalid node_id %d (max=%d), deactivating\n", 
+            printf("ERROR: Fish %d has invalid node_id %d (max=%d), deactivating\n",
                    i, node_id, node_count - 1);
             fish->active = 0;
             validation_errors++;
             continue;
         }
-        
+
         if (!nodes[node_id].active) {
             printf("ERROR: Fish %d node %d is inactive, deactivating fish\n", i, node_id);
             fish->active = 0;
             validation_errors++;
             continue;
         }
-        
+
         // Validate fish type to prevent array access errors
         if (fish->fish_type < 0 || fish->fish_type >= fish_get_type_count()) {
-            printf("ERROR: Fish %d has invalid fish_type %d (max=%d), deactivating\n", 
+            printf("ERROR: Fish %d has invalid fish_type %d (max=%d), deactivating\n",
                    i, fish->fish_type, fish_get_type_count() - 1);
             fish->active = 0;
             validation_errors++;
             continue;
         }
-        
-        FishType* fish_type = &fish_types[fish->fish_type];
-        Node* node = &nodes[node_id];
-        
+
         // Check for natural death from aging
         if (fish_should_die_from_age(i)) {
             fish->active = 0;
-            node->active = 0;
+            simulation_remove_node(node_id);
             deaths_this_frame++;
             continue;
         }
-        
-        // Core fish behavior updates
-        
+
         // Reset reward for this frame
         fish->last_reward = 0.0f;
-        
-        // Update neural network inputs based on environment
-        fish_update_rl_inputs(i);
-        
+
+        sense_batch[batch_count++] = i;
+    }
+
+    // Pass 2 (parallel): fill every fish's rl_inputs across the worker
+    // pool. Sensing is pure reads of the grids and layers, so the whole
+    // batch runs concurrently before the brain consumes it.
+    profiler_stage_begin(PROF_STAGE_VISION);
+    SenseBatch batch = { sense_batch, batch_count };
+    int chunk_count = (batch_count + SENSE_CHUNK_SIZE - 1) / SENSE_CHUNK_SIZE;
+    worker_pool_run(sense_chunk_task, &batch, chunk_count);
+    profiler_stage_end(PROF_STAGE_VISION);
+
+    // Pass 3 (serial): behavior, movement and rewards may eat other
+    // fish, spawn nodes or reproduce, so they stay single-threaded
+    for (int n = 0; n < batch_count; n++) {
+        int i = sense_batch[n];
+
+        // A fish earlier in the batch may have eaten this one
+        if (!fish_array[i].active) continue;
+
+        Fish* fish = &fish_array[i];
+        FishType* fish_type = &fish_types[fish->fish_type];
+        Node* node = &nodes[fish->node_id];
+
         // Apply neural network outputs to control fish
         fish_apply_rl_outputs(i);
         
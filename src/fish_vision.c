@@ -4,12 +4,209 @@
 
 #include "types.h"
 #include "fish.h"
+#include "fish_grid.h"
 #include "simulation.h"
 #include "grid.h"
 #include "plants.h"
 #include "gas.h"
 #include "temperature.h"
 
+// Target kinds for grid-backed vision queries
+#define VISION_TARGET_PLANT 0
+#define VISION_TARGET_CORPSE 1
+
+// Target kinds for fish-grid-backed proximity queries
+#define FISH_TARGET_PREY 0      // weaker foreign fish (predator hunting)
+#define FISH_TARGET_RANKED 1    // foreign fish with a danger differential
+#define FISH_TARGET_FOREIGN 2   // any foreign fish
+
+// Check whether a node is a valid vision target of the requested kind
+static int node_matches_target(Node* node, int node_index, int target) {
+    if (target == VISION_TARGET_PLANT) {
+        if (node->plant_type < 0) return 0;
+        if (node->is_corpse) return 0;
+        if (simulation_is_seed_immune(node_index)) return 0;
+        if (temperature_is_coral_bleached(node_index)) return 0;
+        return 1;
+    }
+    return node->is_corpse;
+}
+
+// Expanding-ring grid search for the nearest matching node inside the
+// FOV cone. Rings grow outward one cell layer at a time and the search
+// stops once the next ring cannot contain anything closer than the
+// current best, so cost tracks local density instead of world population.
+static int find_nearest_node_in_fov(float fish_x, float fish_y, float fish_heading,
+                                    float half_fov, float search_radius, int target,
+                                    float* out_x, float* out_y, float* out_distance) {
+    Node* nodes = simulation_get_nodes();
+    int node_count = simulation_get_node_count();
+
+    int center_x, center_y;
+    grid_world_to_grid_coords(fish_x, fish_y, &center_x, &center_y);
+
+    int max_ring = (int)(search_radius / GRID_SIZE) + 1;
+    float nearest_distance = 99999.0f;
+    int found = 0;
+    float best_x = 0.0f;
+    float best_y = 0.0f;
+
+    for (int ring = 0; ring <= max_ring; ring++) {
+        // Nodes in this ring are at least (ring - 1) cells away
+        if (found && (float)(ring - 1) * GRID_SIZE > nearest_distance) break;
+
+        int min_x = center_x - ring;
+        int max_x = center_x + ring;
+        int min_y = center_y - ring;
+        int max_y = center_y + ring;
+
+        for (int gy = min_y; gy <= max_y; gy++) {
+            // Interior rows only contribute their edge columns
+            int step = (gy == min_y || gy == max_y) ? 1 : (max_x - min_x);
+            if (step <= 0) step = 1;
+
+            for (int gx = min_x; gx <= max_x; gx += step) {
+                GridCell* cell = grid_get_cell(gx, gy);
+                if (!cell) continue;
+
+                // Corpse queries walk the dedicated corpse lane so they
+                // never skip-test the plant population
+                const int* lane = cell->node_indices;
+                int lane_count = cell->count;
+                if (target == VISION_TARGET_CORPSE) {
+                    lane = cell->corpse_indices;
+                    lane_count = cell->corpse_count;
+                }
+                if (lane_count == 0) continue;
+
+                for (int n = 0; n < lane_count; n++) {
+                    int i = lane[n];
+                    if (i < 0 || i >= node_count) continue;
+                    if (!nodes[i].active) continue;
+                    if (!node_matches_target(&nodes[i], i, target)) continue;
+
+                    float dx = nodes[i].x - fish_x;
+                    float dy = nodes[i].y - fish_y;
+                    float distance = sqrt(dx * dx + dy * dy);
+
+                    if (distance > search_radius) continue;
+                    if (distance >= nearest_distance) continue;
+
+                    // Check FOV
+                    float angle_to_node = atan2(dy, dx);
+                    float relative_angle = angle_to_node - fish_heading;
+
+                    while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
+                    while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
+
+                    if (fabs(relative_angle) <= half_fov) {
+                        nearest_distance = distance;
+                        found = 1;
+                        best_x = nodes[i].x;
+                        best_y = nodes[i].y;
+                    }
+                }
+            }
+        }
+    }
+
+    *out_x = best_x;
+    *out_y = best_y;
+    *out_distance = nearest_distance;
+    return found;
+}
+
+// Expanding-ring search over the fish grid for the nearest matching fish
+// inside the FOV cone. Mirrors find_nearest_node_in_fov: rings stop once
+// they cannot beat the current best, so predator-prey sensing scales with
+// local density instead of total fish population.
+static int find_nearest_fish_in_fov(int fish_id, float fish_x, float fish_y,
+                                    float fish_heading, float half_fov,
+                                    float detection_range, int target,
+                                    float* out_x, float* out_y,
+                                    float* out_distance, float* out_danger) {
+    Fish* fish = fish_get_by_id(fish_id);
+    if (!fish) return 0;
+
+    FishType* fish_type = fish_get_type(fish->fish_type);
+    if (!fish_type) return 0;
+
+    Node* nodes = simulation_get_nodes();
+    Fish* all_fish = fish_get_all();
+
+    int center_x, center_y;
+    fish_grid_world_to_coords(fish_x, fish_y, &center_x, &center_y);
+
+    int max_ring = (int)(detection_range / FISH_GRID_SIZE) + 1;
+    float nearest_distance = 99999.0f;
+    int found = 0;
+    float best_x = 0.0f;
+    float best_y = 0.0f;
+    float best_danger = 0.0f;
+
+    for (int ring = 0; ring <= max_ring; ring++) {
+        // Fish in this ring are at least (ring - 1) cells away
+        if (found && (float)(ring - 1) * FISH_GRID_SIZE > nearest_distance) break;
+
+        int min_x = center_x - ring;
+        int max_x = center_x + ring;
+        int min_y = center_y - ring;
+        int max_y = center_y + ring;
+
+        for (int gy = min_y; gy <= max_y; gy++) {
+            // Interior rows only contribute their edge columns
+            int step = (gy == min_y || gy == max_y) ? 1 : (max_x - min_x);
+            if (step <= 0) step = 1;
+
+            for (int gx = min_x; gx <= max_x; gx += step) {
+                for (int i = fish_grid_cell_head(gx, gy); i >= 0; i = fish_grid_next(i)) {
+                    if (i == fish_id) continue;
+                    if (!all_fish[i].active) continue;
+                    if (all_fish[i].fish_type == fish->fish_type) continue;
+
+                    Node* other_fish_node = &nodes[all_fish[i].node_id];
+                    if (!other_fish_node->active) continue;
+
+                    FishType* other_fish_type = fish_get_type(all_fish[i].fish_type);
+                    if (!other_fish_type) continue;
+
+                    float relative_danger = other_fish_type->danger_level - fish_type->danger_level;
+                    if (target == FISH_TARGET_PREY && relative_danger >= 0.0f) continue;
+                    if (target == FISH_TARGET_RANKED && fabs(relative_danger) < 0.01f) continue;
+
+                    float dx = other_fish_node->x - fish_x;
+                    float dy = other_fish_node->y - fish_y;
+                    float distance = sqrt(dx * dx + dy * dy);
+
+                    if (distance > detection_range) continue;
+                    if (distance >= nearest_distance) continue;
+
+                    // Check FOV
+                    float angle_to_fish = atan2(dy, dx);
+                    float relative_angle = angle_to_fish - fish_heading;
+
+                    while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
+                    while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
+
+                    if (fabs(relative_angle) <= half_fov) {
+                        nearest_distance = distance;
+                        found = 1;
+                        best_x = other_fish_node->x;
+                        best_y = other_fish_node->y;
+                        best_danger = relative_danger;
+                    }
+                }
+            }
+        }
+    }
+
+    *out_x = best_x;
+    *out_y = best_y;
+    *out_distance = nearest_distance;
+    if (out_danger) *out_danger = best_danger;
+    return found;
+}
+
 // Find nearest plant within FOV for herbivores (excludes immune seeds and bleached corals)
 static int find_nearest_plant_in_fov(int fish_id, float* plant_vector_x, float* plant_vector_y, float* plant_distance) {
     Fish* fish = fish_get_by_id(fish_id);
@@ -38,52 +235,13 @@ static int find_nearest_plant_in_fov(int fish_id, float* plant_vector_x, float*
     float fov_rad = (fish_type->fov_angle * M_PI) / 180.0f;
     float half_fov = fov_rad * 0.5f;
     
-    float nearest_distance = 99999.0f;
-    int found_plant = 0;
-    float best_plant_x = 0.0f;
-    float best_plant_y = 0.0f;
-    
     float search_radius = 1200.0f;
-    int node_count = simulation_get_node_count();
-    
-    for (int i = 0; i < node_count; i++) {
-        if (!nodes[i].active) continue;
-        if (nodes[i].plant_type < 0) continue;
-        if (nodes[i].is_corpse) continue;
-        
-        // Skip immune seeds
-        if (nodes[i].seed_immunity_timer > 0) {
-            continue;
-        }
-        
-        // Skip bleached corals
-        if (temperature_is_coral_bleached(i)) {
-            continue;
-        }
-        
-        float dx = nodes[i].x - fish_x;
-        float dy = nodes[i].y - fish_y;
-        float distance = sqrt(dx * dx + dy * dy);
-        
-        if (distance > search_radius) continue;
-        
-        // Check FOV
-        float angle_to_plant = atan2(dy, dx);
-        float relative_angle = angle_to_plant - fish_heading;
-        
-        while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
-        while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
-        
-        if (fabs(relative_angle) <= half_fov) {
-            if (distance < nearest_distance) {
-                nearest_distance = distance;
-                found_plant = 1;
-                best_plant_x = nodes[i].x;
-                best_plant_y = nodes[i].y;
-            }
-        }
-    }
-    
+
+    float nearest_distance, best_plant_x, best_plant_y;
+    int found_plant = find_nearest_node_in_fov(fish_x, fish_y, fish_heading,
+                                               half_fov, search_radius, VISION_TARGET_PLANT,
+                                               &best_plant_x, &best_plant_y, &nearest_distance);
+
     if (found_plant) {
         float dx = best_plant_x - fish_x;
         float dy = best_plant_y - fish_y;
@@ -127,92 +285,37 @@ static int find_nearest_prey_fish_in_fov(int fish_id, float* prey_vector_x, floa
     
     Node* nodes = simulation_get_nodes();
     Node* fish_node = &nodes[fish->node_id];
-    Fish* all_fish = fish_get_all();
-    int fish_count = fish_get_count();
-    
+
     float fish_x = fish_node->x;
     float fish_y = fish_node->y;
     float fish_heading = fish->heading;
-    
+
     float fov_rad = (fish_type->fov_angle * M_PI) / 180.0f;
     float half_fov = fov_rad * 0.5f;
-    
-    float nearest_distance = 99999.0f;
-    int found_prey = 0;
-    float best_prey_x = 0.0f;
-    float best_prey_y = 0.0f;
-    
+
     float detection_range = fish_type->fish_detection_range;
     if (detection_range <= 0.0f) detection_range = 1000.0f;
-    
-    // Check living fish
-    for (int i = 0; i < fish_count; i++) {
-        if (!all_fish[i].active) continue;
-        if (i == fish_id) continue;
-        
-        Node* other_fish_node = &nodes[all_fish[i].node_id];
-        if (!other_fish_node->active) continue;
-        
-        FishType* other_fish_type = fish_get_type(all_fish[i].fish_type);
-        if (!other_fish_type) continue;
-        
-        if (all_fish[i].fish_type == fish->fish_type) continue;
-        
-        // Only target weaker prey
-        if (other_fish_type->danger_level >= fish_type->danger_level) continue;
-        
-        float dx = other_fish_node->x - fish_x;
-        float dy = other_fish_node->y - fish_y;
-        float distance = sqrt(dx * dx + dy * dy);
-        
-        if (distance > detection_range) continue;
-        
-        // Check FOV
-        float angle_to_fish = atan2(dy, dx);
-        float relative_angle = angle_to_fish - fish_heading;
-        
-        while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
-        while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
-        
-        if (fabs(relative_angle) <= half_fov) {
-            if (distance < nearest_distance) {
-                nearest_distance = distance;
-                found_prey = 1;
-                best_prey_x = other_fish_node->x;
-                best_prey_y = other_fish_node->y;
-            }
-        }
-    }
-    
-    // Check corpses
-    int node_count = simulation_get_node_count();
-    for (int i = 0; i < node_count; i++) {
-        if (!nodes[i].active) continue;
-        if (!nodes[i].is_corpse) continue;
-        
-        float dx = nodes[i].x - fish_x;
-        float dy = nodes[i].y - fish_y;
-        float distance = sqrt(dx * dx + dy * dy);
-        
-        if (distance > detection_range) continue;
-        
-        // Check FOV
-        float angle_to_corpse = atan2(dy, dx);
-        float relative_angle = angle_to_corpse - fish_heading;
-        
-        while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
-        while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
-        
-        if (fabs(relative_angle) <= half_fov) {
-            if (distance < nearest_distance) {
-                nearest_distance = distance;
-                found_prey = 1;
-                best_prey_x = nodes[i].x;
-                best_prey_y = nodes[i].y;
-            }
+
+    // Check living fish via the fish grid (only weaker prey match)
+    float nearest_distance, best_prey_x, best_prey_y;
+    int found_prey = find_nearest_fish_in_fov(fish_id, fish_x, fish_y, fish_heading,
+                                              half_fov, detection_range, FISH_TARGET_PREY,
+                                              &best_prey_x, &best_prey_y,
+                                              &nearest_distance, NULL);
+
+    // Check corpses via the spatial grid
+    float corpse_x, corpse_y, corpse_distance;
+    if (find_nearest_node_in_fov(fish_x, fish_y, fish_heading,
+                                 half_fov, detection_range, VISION_TARGET_CORPSE,
+                                 &corpse_x, &corpse_y, &corpse_distance)) {
+        if (corpse_distance < nearest_distance) {
+            nearest_distance = corpse_distance;
+            found_prey = 1;
+            best_prey_x = corpse_x;
+            best_prey_y = corpse_y;
         }
     }
-    
+
     if (found_prey) {
         float dx = best_prey_x - fish_x;
         float dy = best_prey_y - fish_y;
@@ -256,65 +359,24 @@ static int find_nearest_foreign_fish_in_fov(int fish_id, float* fish_vector_x, f
     
     Node* nodes = simulation_get_nodes();
     Node* fish_node = &nodes[fish->node_id];
-    Fish* all_fish = fish_get_all();
-    int fish_count = fish_get_count();
-    
+
     float fish_x = fish_node->x;
     float fish_y = fish_node->y;
     float fish_heading = fish->heading;
-    
+
     float fov_rad = (fish_type->fov_angle * M_PI) / 180.0f;
     float half_fov = fov_rad * 0.5f;
-    
-    float nearest_distance = 99999.0f;
-    int found_target = 0;
-    float best_target_x = 0.0f;
-    float best_target_y = 0.0f;
-    float best_danger_level = 0.0f;
-    
+
     float detection_range = fish_type->fish_detection_range;
     if (detection_range <= 0.0f) detection_range = 800.0f;
-    
-    for (int i = 0; i < fish_count; i++) {
-        if (!all_fish[i].active) continue;
-        if (i == fish_id) continue;
-        
-        Node* other_fish_node = &nodes[all_fish[i].node_id];
-        if (!other_fish_node->active) continue;
-        
-        FishType* other_fish_type = fish_get_type(all_fish[i].fish_type);
-        if (!other_fish_type) continue;
-        
-        if (all_fish[i].fish_type == fish->fish_type) continue;
-        
-        float dx = other_fish_node->x - fish_x;
-        float dy = other_fish_node->y - fish_y;
-        float distance = sqrt(dx * dx + dy * dy);
-        
-        if (distance > detection_range) continue;
-        
-        // Check FOV
-        float angle_to_fish = atan2(dy, dx);
-        float relative_angle = angle_to_fish - fish_heading;
-        
-        while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
-        while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
-        
-        if (fabs(relative_angle) <= half_fov) {
-            float relative_danger = other_fish_type->danger_level - fish_type->danger_level;
-            
-            if (fabs(relative_danger) < 0.01f) continue;
-            
-            if (distance < nearest_distance) {
-                nearest_distance = distance;
-                found_target = 1;
-                best_target_x = other_fish_node->x;
-                best_target_y = other_fish_node->y;
-                best_danger_level = relative_danger;
-            }
-        }
-    }
-    
+
+    // Fish-grid search for the nearest foreign fish with a danger differential
+    float nearest_distance, best_target_x, best_target_y, best_danger_level;
+    int found_target = find_nearest_fish_in_fov(fish_id, fish_x, fish_y, fish_heading,
+                                                half_fov, detection_range, FISH_TARGET_RANKED,
+                                                &best_target_x, &best_target_y,
+                                                &nearest_distance, &best_danger_level);
+
     if (found_target) {
         float dx = best_target_x - fish_x;
         float dy = best_target_y - fish_y;
@@ -407,32 +469,15 @@ float fish_get_distance_to_nearest_plant(int fish_id) {
     
     float fish_x = fish_node->x;
     float fish_y = fish_node->y;
-    float nearest_distance = 99999.0f;
-    
-    int node_count = simulation_get_node_count();
-    for (int i = 0; i < node_count; i++) {
-        if (!nodes[i].active) continue;
-        if (nodes[i].plant_type < 0) continue;
-        if (nodes[i].is_corpse) continue;
-        
-        if (nodes[i].seed_immunity_timer > 0) {
-            continue;
-        }
-        
-        // Skip bleached corals
-        if (temperature_is_coral_bleached(i)) {
-            continue;
-        }
-        
-        float dx = nodes[i].x - fish_x;
-        float dy = nodes[i].y - fish_y;
-        float distance = sqrt(dx * dx + dy * dy);
-        
-        if (distance < nearest_distance) {
-            nearest_distance = distance;
-        }
+
+    // Full-circle grid search (half FOV of pi accepts every direction)
+    float plant_x, plant_y, nearest_distance;
+    if (!find_nearest_node_in_fov(fish_x, fish_y, 0.0f,
+                                  M_PI, 1200.0f, VISION_TARGET_PLANT,
+                                  &plant_x, &plant_y, &nearest_distance)) {
+        return 99999.0f;
     }
-    
+
     return nearest_distance;
 }
 
@@ -478,75 +523,35 @@ float fish_get_distance_to_nearest_foreign_fish(int fish_id) {
     
     Node* nodes = simulation_get_nodes();
     Node* fish_node = &nodes[fish->node_id];
-    Fish* all_fish = fish_get_all();
-    int fish_count = fish_get_count();
-    
+
     float fish_x = fish_node->x;
     float fish_y = fish_node->y;
     float fish_heading = fish->heading;
-    float nearest_distance = 99999.0f;
-    
+
     float fov_rad = (fish_type->fov_angle * M_PI) / 180.0f;
     float half_fov = fov_rad * 0.5f;
     float detection_range = fish_type->fish_detection_range;
     if (detection_range <= 0.0f) detection_range = 500.0f;
-    
-    // Check living fish
-    for (int i = 0; i < fish_count; i++) {
-        if (!all_fish[i].active) continue;
-        if (i == fish_id) continue;
-        if (all_fish[i].fish_type == fish->fish_type) continue;
-        
-        Node* other_fish_node = &nodes[all_fish[i].node_id];
-        if (!other_fish_node->active) continue;
-        
-        float dx = other_fish_node->x - fish_x;
-        float dy = other_fish_node->y - fish_y;
-        float distance = sqrt(dx * dx + dy * dy);
-        
-        if (distance > detection_range) continue;
-        
-        // Check FOV
-        float angle_to_fish = atan2(dy, dx);
-        float relative_angle = angle_to_fish - fish_heading;
-        
-        while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
-        while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
-        
-        if (fabs(relative_angle) <= half_fov) {
-            if (distance < nearest_distance) {
-                nearest_distance = distance;
-            }
-        }
+
+    // Check living fish via the fish grid
+    float foreign_x, foreign_y, nearest_distance;
+    if (!find_nearest_fish_in_fov(fish_id, fish_x, fish_y, fish_heading,
+                                  half_fov, detection_range, FISH_TARGET_FOREIGN,
+                                  &foreign_x, &foreign_y, &nearest_distance, NULL)) {
+        nearest_distance = 99999.0f;
     }
-    
-    // Check corpses (predators only)
+
+    // Check corpses via the spatial grid (predators only)
     if (fish_type->is_predator) {
-        int node_count = simulation_get_node_count();
-        for (int i = 0; i < node_count; i++) {
-            if (!nodes[i].active) continue;
-            if (!nodes[i].is_corpse) continue;
-            
-            float dx = nodes[i].x - fish_x;
-            float dy = nodes[i].y - fish_y;
-            float distance = sqrt(dx * dx + dy * dy);
-            
-            if (distance > detection_range) continue;
-            
-            // Check FOV
-            float angle_to_corpse = atan2(dy, dx);
-            float relative_angle = angle_to_corpse - fish_heading;
-            
-            while (relative_angle > M_PI) relative_angle -= 2.0f * M_PI;
-            while (relative_angle < -M_PI) relative_angle += 2.0f * M_PI;
-            
-            if (fabs(relative_angle) <= half_fov) {
-                if (distance < nearest_distance) {
-                    nearest_distance = distance;
-                }
+        float corpse_x, corpse_y, corpse_distance;
+        if (find_nearest_node_in_fov(fish_x, fish_y, fish_heading,
+                                     half_fov, detection_range, VISION_TARGET_CORPSE,
+                                     &corpse_x, &corpse_y, &corpse_distance)) {
+            if (corpse_distance < nearest_distance) {
+                nearest_distance = corpse_distance;
             }
         }
     }
-    
+
     return nearest_distance;
 }
\ No newline at end of file
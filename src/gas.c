@@ -2,18 +2,35 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+
+#ifndef HEADLESS_BUILD
 #include <SDL2/SDL.h>
+#endif
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "types.h"
 #include "gas.h"
+#ifndef HEADLESS_BUILD
 #include "camera.h"
+#endif
 #include "simulation.h"
+#include "grid.h"
 #include "plants.h"
 #include "temperature.h"
 
 #define GAS_DECAY_RATE 0.002f
 #define GAS_BASE_LEVEL 0.0f
 
+// Dirty-region tiling: the oxygen field is split into square tiles of
+// layer cells. Production is re-accumulated only for tiles whose plant
+// population changed, and the blend kernel skips tiles whose gradient
+// has converged against the target field.
+#define GAS_TILE_SIZE 16
+#define GAS_CONVERGE_EPSILON 0.001f
+
 // Oxygen distribution grid system
 static float* g_oxygen_grid = NULL;
 static float* g_oxygen_target = NULL;
@@ -22,28 +39,52 @@ static int g_grid_height = 0;
 static int g_visible = 0;
 static SDL_Renderer* g_renderer = NULL;
 
+// Per-tile state
+static int g_tile_cols = 0;
+static int g_tile_rows = 0;
+static unsigned char* g_tile_dirty = NULL;      // Target must be rebuilt
+static unsigned char* g_tile_converged = NULL;  // Grid reached target, blend skipped
+
 int gas_init(void) {
     g_grid_width = (int)ceil(WORLD_WIDTH / LAYER_GRID_SIZE);
     g_grid_height = (int)ceil(WORLD_HEIGHT / LAYER_GRID_SIZE);
-    
+
     g_oxygen_grid = malloc(g_grid_width * g_grid_height * sizeof(float));
     g_oxygen_target = malloc(g_grid_width * g_grid_height * sizeof(float));
-    
+
     if (!g_oxygen_grid || !g_oxygen_target) {
         printf("Failed to allocate oxygen grids\n");
         return 0;
     }
-    
+
     // Initialize grids with base oxygen level
     for (int i = 0; i < g_grid_width * g_grid_height; i++) {
         g_oxygen_grid[i] = GAS_BASE_LEVEL;
         g_oxygen_target[i] = GAS_BASE_LEVEL;
     }
-    
+
+    g_tile_cols = (g_grid_width + GAS_TILE_SIZE - 1) / GAS_TILE_SIZE;
+    g_tile_rows = (g_grid_height + GAS_TILE_SIZE - 1) / GAS_TILE_SIZE;
+
+    g_tile_dirty = calloc(g_tile_cols * g_tile_rows, sizeof(unsigned char));
+    g_tile_converged = calloc(g_tile_cols * g_tile_rows, sizeof(unsigned char));
+
+    if (!g_tile_dirty || !g_tile_converged) {
+        printf("Failed to allocate oxygen tile flags\n");
+        free(g_oxygen_grid);
+        g_oxygen_grid = NULL;
+        free(g_oxygen_target);
+        g_oxygen_target = NULL;
+        return 0;
+    }
+
+    // Rebuild everything once on the first update
+    memset(g_tile_dirty, 1, g_tile_cols * g_tile_rows);
+
     g_visible = 0;
-    
-    printf("Gas layer initialized: %dx%d grid (%.1f unit cells)\n", 
-           g_grid_width, g_grid_height, LAYER_GRID_SIZE);
+
+    printf("Gas layer initialized: %dx%d grid (%.1f unit cells, %dx%d tiles)\n",
+           g_grid_width, g_grid_height, LAYER_GRID_SIZE, g_tile_cols, g_tile_rows);
     return 1;
 }
 
@@ -56,6 +97,47 @@ void gas_cleanup(void) {
         free(g_oxygen_target);
         g_oxygen_target = NULL;
     }
+    if (g_tile_dirty) {
+        free(g_tile_dirty);
+        g_tile_dirty = NULL;
+    }
+    if (g_tile_converged) {
+        free(g_tile_converged);
+        g_tile_converged = NULL;
+    }
+}
+
+// Mark tiles overlapping a circular region as needing a target rebuild.
+// Called when a producer appears, disappears or changes (bleaching).
+void gas_mark_dirty_region(float world_x, float world_y, float radius) {
+    if (!g_tile_dirty) return;
+
+    float tile_world = GAS_TILE_SIZE * LAYER_GRID_SIZE;
+    int min_tx = (int)floor((world_x - radius - WORLD_LEFT) / tile_world);
+    int max_tx = (int)floor((world_x + radius - WORLD_LEFT) / tile_world);
+    int min_ty = (int)floor((world_y - radius - WORLD_TOP) / tile_world);
+    int max_ty = (int)floor((world_y + radius - WORLD_TOP) / tile_world);
+
+    if (min_tx < 0) min_tx = 0;
+    if (min_ty < 0) min_ty = 0;
+    if (max_tx >= g_tile_cols) max_tx = g_tile_cols - 1;
+    if (max_ty >= g_tile_rows) max_ty = g_tile_rows - 1;
+
+    for (int ty = min_ty; ty <= max_ty; ty++) {
+        for (int tx = min_tx; tx <= max_tx; tx++) {
+            g_tile_dirty[ty * g_tile_cols + tx] = 1;
+            g_tile_converged[ty * g_tile_cols + tx] = 0;
+        }
+    }
+}
+
+// Notify the gas layer that a plant node changed at this position
+void gas_mark_plant_changed(float world_x, float world_y, int plant_type) {
+    PlantType* pt = plants_get_type(plant_type);
+    if (!pt) return;
+    if (pt->oxygen_production_factor <= 0.0f || pt->oxygen_production_radius <= 0.0f) return;
+
+    gas_mark_dirty_region(world_x, world_y, pt->oxygen_production_radius);
 }
 
 void gas_set_renderer(SDL_Renderer* renderer) {
@@ -87,6 +169,26 @@ float gas_get_oxygen_at(float world_x, float world_y) {
     return g_oxygen_grid[grid_y * g_grid_width + grid_x];
 }
 
+// Snapshot support
+int gas_get_grid_cell_count(void) {
+    return g_grid_width * g_grid_height;
+}
+
+float* gas_get_grid(void) {
+    return g_oxygen_grid;
+}
+
+void gas_snapshot_restore(const float* grid) {
+    if (!g_oxygen_grid) return;
+
+    memcpy(g_oxygen_grid, grid, g_grid_width * g_grid_height * sizeof(float));
+
+    // Production targets depend on the restored plant population, so
+    // rebuild every tile on the next heatmap update
+    memset(g_tile_dirty, 1, g_tile_cols * g_tile_rows);
+    memset(g_tile_converged, 0, g_tile_cols * g_tile_rows);
+}
+
 void gas_decay_oxygen(void) {
     if (!g_oxygen_grid) return;
     
@@ -99,121 +201,254 @@ void gas_decay_oxygen(void) {
     }
 }
 
-void gas_update_heatmap(void) {
-    if (!g_oxygen_grid || !g_oxygen_target) return;
-    
-    // Clear target grid
-    memset(g_oxygen_target, 0, g_grid_width * g_grid_height * sizeof(float));
-    
-    // Calculate target oxygen levels from plant positions
+// Aggressive falloff curve for oxygen production
+static float production_falloff(float normalized_distance) {
+    if (normalized_distance < 0.3f) {
+        // Inner zone: full strength with slight dropoff
+        return 1.0f - (normalized_distance / 0.3f) * 0.2f; // 100% to 80%
+    } else if (normalized_distance < 0.6f) {
+        // Middle zone: rapid dropoff
+        float t = (normalized_distance - 0.3f) / 0.3f;
+        return 0.8f - t * t * t * 0.7f; // 80% to 10%
+    } else {
+        // Outer zone: steep dropoff to near zero
+        float t = (normalized_distance - 0.6f) / 0.4f;
+        return 0.1f * (1.0f - t * t * t * t); // 10% to ~0%
+    }
+}
+
+// Largest production radius across loaded plant types, used to size the
+// producer search window around a tile
+static float max_production_radius(void) {
+    float max_radius = 0.0f;
+    for (int i = 0; i < plants_get_type_count(); i++) {
+        PlantType* pt = plants_get_type(i);
+        if (!pt || !pt->active) continue;
+        if (pt->oxygen_production_factor <= 0.0f) continue;
+        if (pt->oxygen_production_radius > max_radius) {
+            max_radius = pt->oxygen_production_radius;
+        }
+    }
+    return max_radius;
+}
+
+// Recompute the target field for one tile by gathering producers from
+// the spatial grid within max production radius of the tile bounds
+static void rebuild_tile_target(int tile_x, int tile_y, float search_radius) {
+    int cell_x0 = tile_x * GAS_TILE_SIZE;
+    int cell_y0 = tile_y * GAS_TILE_SIZE;
+    int cell_x1 = cell_x0 + GAS_TILE_SIZE;
+    int cell_y1 = cell_y0 + GAS_TILE_SIZE;
+    if (cell_x1 > g_grid_width) cell_x1 = g_grid_width;
+    if (cell_y1 > g_grid_height) cell_y1 = g_grid_height;
+
+    // Clear this tile's slice of the target field
+    for (int gy = cell_y0; gy < cell_y1; gy++) {
+        memset(&g_oxygen_target[gy * g_grid_width + cell_x0], 0,
+               (cell_x1 - cell_x0) * sizeof(float));
+    }
+
+    if (search_radius <= 0.0f) return;
+
+    float tile_left = WORLD_LEFT + cell_x0 * LAYER_GRID_SIZE;
+    float tile_top = WORLD_TOP + cell_y0 * LAYER_GRID_SIZE;
+    float tile_right = WORLD_LEFT + cell_x1 * LAYER_GRID_SIZE;
+    float tile_bottom = WORLD_TOP + cell_y1 * LAYER_GRID_SIZE;
+
+    int min_gx, min_gy, max_gx, max_gy;
+    grid_world_to_grid_coords(tile_left - search_radius, tile_top - search_radius, &min_gx, &min_gy);
+    grid_world_to_grid_coords(tile_right + search_radius, tile_bottom + search_radius, &max_gx, &max_gy);
+
+    if (min_gx < 0) min_gx = 0;
+    if (min_gy < 0) min_gy = 0;
+    if (max_gx >= grid_get_width()) max_gx = grid_get_width() - 1;
+    if (max_gy >= grid_get_height()) max_gy = grid_get_height() - 1;
+
     Node* nodes = simulation_get_nodes();
     int node_count = simulation_get_node_count();
-    
-    for (int node_idx = 0; node_idx < node_count; node_idx++) {
-        if (!nodes[node_idx].active) continue;
-        
-        int plant_type = nodes[node_idx].plant_type;
-        if (plant_type < 0 || plant_type >= plants_get_type_count()) continue;
-        
-        PlantType* pt = plants_get_type(plant_type);
-        if (!pt) continue;
-        
-        // Skip oxygen production for bleached corals
-        if (temperature_is_coral_bleached(node_idx)) {
-            continue;
-        }
-        
-        float node_x = nodes[node_idx].x;
-        float node_y = nodes[node_idx].y;
-        float production_factor = pt->oxygen_production_factor;
-        float production_radius = pt->oxygen_production_radius;
-        
-        if (production_factor <= 0.0f || production_radius <= 0.0f) continue;
-        
-        // Calculate grid bounds for this node's influence
-        int center_grid_x = (int)floor((node_x - WORLD_LEFT) / LAYER_GRID_SIZE);
-        int center_grid_y = (int)floor((node_y - WORLD_TOP) / LAYER_GRID_SIZE);
-        
-        int grid_radius = (int)ceil(production_radius / LAYER_GRID_SIZE);
-        
-        // Apply oxygen production to target grid
-        for (int dy = -grid_radius; dy <= grid_radius; dy++) {
-            for (int dx = -grid_radius; dx <= grid_radius; dx++) {
-                int grid_x = center_grid_x + dx;
-                int grid_y = center_grid_y + dy;
-                
-                if (grid_x < 0 || grid_x >= g_grid_width || 
-                    grid_y < 0 || grid_y >= g_grid_height) {
+
+    for (int gy = min_gy; gy <= max_gy; gy++) {
+        for (int gx = min_gx; gx <= max_gx; gx++) {
+            GridCell* cell = grid_get_cell(gx, gy);
+            if (!cell) continue;
+
+            for (int k = 0; k < cell->count; k++) {
+                int node_idx = cell->node_indices[k];
+                if (node_idx < 0 || node_idx >= node_count) continue;
+                if (!nodes[node_idx].active) continue;
+
+                int plant_type = nodes[node_idx].plant_type;
+                if (plant_type < 0 || plant_type >= plants_get_type_count()) continue;
+
+                PlantType* pt = plants_get_type(plant_type);
+                if (!pt) continue;
+
+                // Skip oxygen production for bleached corals
+                if (temperature_is_coral_bleached(node_idx)) {
                     continue;
                 }
-                
-                // Calculate world position of grid cell center
-                float grid_world_x = WORLD_LEFT + (grid_x + 0.5f) * LAYER_GRID_SIZE;
-                float grid_world_y = WORLD_TOP + (grid_y + 0.5f) * LAYER_GRID_SIZE;
-                
-                // Calculate distance from node to grid cell
-                float distance = sqrt((grid_world_x - node_x) * (grid_world_x - node_x) + 
-                                    (grid_world_y - node_y) * (grid_world_y - node_y));
-                
-                if (distance <= production_radius) {
-                    float normalized_distance = distance / production_radius;
-                    
-                    // Aggressive falloff for oxygen production
-                    float falloff;
-                    
-                    if (normalized_distance < 0.3f) {
-                        // Inner zone: full strength with slight dropoff
-                        falloff = 1.0f - (normalized_distance / 0.3f) * 0.2f; // 100% to 80%
-                    } else if (normalized_distance < 0.6f) {
-                        // Middle zone: rapid dropoff
-                        float t = (normalized_distance - 0.3f) / 0.3f;
-                        falloff = 0.8f - t * t * t * 0.7f; // 80% to 10%
-                    } else {
-                        // Outer zone: steep dropoff to near zero
-                        float t = (normalized_distance - 0.6f) / 0.4f;
-                        falloff = 0.1f * (1.0f - t * t * t * t); // 10% to ~0%
-                    }
-                    
-                    // Set target oxygen level (take maximum if multiple plants overlap)
-                    float target_contribution = production_factor * falloff;
-                    
-                    int index = grid_y * g_grid_width + grid_x;
-                    if (target_contribution > g_oxygen_target[index]) {
-                        g_oxygen_target[index] = target_contribution;
+
+                float node_x = nodes[node_idx].x;
+                float node_y = nodes[node_idx].y;
+                float production_factor = pt->oxygen_production_factor;
+                float production_radius = pt->oxygen_production_radius;
+
+                if (production_factor <= 0.0f || production_radius <= 0.0f) continue;
+
+                // Clip the node's influence square to this tile
+                int center_grid_x = (int)floor((node_x - WORLD_LEFT) / LAYER_GRID_SIZE);
+                int center_grid_y = (int)floor((node_y - WORLD_TOP) / LAYER_GRID_SIZE);
+                int grid_radius = (int)ceil(production_radius / LAYER_GRID_SIZE);
+
+                int span_x0 = center_grid_x - grid_radius;
+                int span_x1 = center_grid_x + grid_radius;
+                int span_y0 = center_grid_y - grid_radius;
+                int span_y1 = center_grid_y + grid_radius;
+
+                if (span_x0 < cell_x0) span_x0 = cell_x0;
+                if (span_y0 < cell_y0) span_y0 = cell_y0;
+                if (span_x1 >= cell_x1) span_x1 = cell_x1 - 1;
+                if (span_y1 >= cell_y1) span_y1 = cell_y1 - 1;
+
+                for (int grid_y = span_y0; grid_y <= span_y1; grid_y++) {
+                    for (int grid_x = span_x0; grid_x <= span_x1; grid_x++) {
+                        // Calculate world position of grid cell center
+                        float grid_world_x = WORLD_LEFT + (grid_x + 0.5f) * LAYER_GRID_SIZE;
+                        float grid_world_y = WORLD_TOP + (grid_y + 0.5f) * LAYER_GRID_SIZE;
+
+                        float distance = sqrt((grid_world_x - node_x) * (grid_world_x - node_x) +
+                                            (grid_world_y - node_y) * (grid_world_y - node_y));
+
+                        if (distance <= production_radius) {
+                            float normalized_distance = distance / production_radius;
+                            float target_contribution = production_factor * production_falloff(normalized_distance);
+
+                            // Take maximum if multiple plants overlap
+                            int index = grid_y * g_grid_width + grid_x;
+                            if (target_contribution > g_oxygen_target[index]) {
+                                g_oxygen_target[index] = target_contribution;
+                            }
+                        }
                     }
                 }
             }
         }
     }
-    
-    // Blend current oxygen levels towards target values
-    float blend_rate = 0.08f;
-    
-    for (int i = 0; i < g_grid_width * g_grid_height; i++) {
-        float current = g_oxygen_grid[i];
-        float target = g_oxygen_target[i];
-        
-        if (target > current) {
+}
+
+// Blend one row segment of the oxygen field towards its target.
+// Returns nonzero while the segment is still off target.
+static int blend_row(float* grid, const float* target, int count) {
+    const float blend_rate = 0.08f;
+    int pending = 0;
+    int i = 0;
+
+#ifdef __SSE2__
+    __m128 zero = _mm_setzero_ps();
+    __m128 two = _mm_set1_ps(2.0f);
+    __m128 up_rate = _mm_set1_ps(blend_rate * 0.5f);
+    __m128 down_rate = _mm_set1_ps(blend_rate * 0.05f);
+    __m128 decay = _mm_set1_ps(GAS_DECAY_RATE);
+    __m128 epsilon = _mm_set1_ps(GAS_CONVERGE_EPSILON);
+    __m128 still_off = zero;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 current = _mm_loadu_ps(&grid[i]);
+        __m128 wanted = _mm_loadu_ps(&target[i]);
+        __m128 delta = _mm_sub_ps(wanted, current);
+
+        // Rising cells blend quickly, falling cells decay slowly
+        __m128 rising = _mm_cmpgt_ps(delta, zero);
+        __m128 rate = _mm_or_ps(_mm_and_ps(rising, up_rate),
+                                _mm_andnot_ps(rising, down_rate));
+        __m128 next = _mm_add_ps(current, _mm_mul_ps(delta, rate));
+        next = _mm_sub_ps(next, _mm_andnot_ps(rising, decay));
+
+        next = _mm_max_ps(next, zero);
+        next = _mm_min_ps(next, two);
+        _mm_storeu_ps(&grid[i], next);
+
+        __m128 remaining = _mm_sub_ps(wanted, next);
+        __m128 magnitude = _mm_max_ps(remaining, _mm_sub_ps(zero, remaining));
+        still_off = _mm_or_ps(still_off, _mm_cmpgt_ps(magnitude, epsilon));
+    }
+    pending |= _mm_movemask_ps(still_off);
+#endif
+
+    for (; i < count; i++) {
+        float current = grid[i];
+        float wanted = target[i];
+
+        if (wanted > current) {
             // Oxygen increasing: blend towards target quickly
-            g_oxygen_grid[i] = current + (target - current) * blend_rate * 0.5f;
+            current = current + (wanted - current) * blend_rate * 0.5f;
         } else {
             // Oxygen decreasing: decay slowly for trail effect
-            g_oxygen_grid[i] = current + (target - current) * blend_rate * 0.05f;
-            
+            current = current + (wanted - current) * blend_rate * 0.05f;
+
             // Additional natural decay
-            g_oxygen_grid[i] -= GAS_DECAY_RATE;
+            current -= GAS_DECAY_RATE;
         }
-        
-        // Clamp values
-        if (g_oxygen_grid[i] < 0.0f) {
-            g_oxygen_grid[i] = 0.0f;
+
+        if (current < 0.0f) current = 0.0f;
+        if (current > 2.0f) current = 2.0f;
+        grid[i] = current;
+
+        if (fabsf(wanted - current) > GAS_CONVERGE_EPSILON) pending = 1;
+    }
+
+    return pending;
+}
+
+void gas_update_heatmap(void) {
+    if (!g_oxygen_grid || !g_oxygen_target) return;
+
+    // Plants drift slowly under repulsion without generating change
+    // events, so refresh everything on the same cadence as the grid
+    // rebuild to keep the field from going stale
+    if (simulation_get_frame_counter() % 300 == 0) {
+        memset(g_tile_dirty, 1, g_tile_cols * g_tile_rows);
+    }
+
+    // Phase 1: rebuild the target field for tiles whose producers changed
+    float search_radius = max_production_radius();
+    for (int ty = 0; ty < g_tile_rows; ty++) {
+        for (int tx = 0; tx < g_tile_cols; tx++) {
+            if (!g_tile_dirty[ty * g_tile_cols + tx]) continue;
+            rebuild_tile_target(tx, ty, search_radius);
+            g_tile_dirty[ty * g_tile_cols + tx] = 0;
+            g_tile_converged[ty * g_tile_cols + tx] = 0;
         }
-        if (g_oxygen_grid[i] > 2.0f) {
-            g_oxygen_grid[i] = 2.0f;
+    }
+
+    // Phase 2: blend unconverged tiles towards their targets
+    for (int ty = 0; ty < g_tile_rows; ty++) {
+        int cell_y0 = ty * GAS_TILE_SIZE;
+        int cell_y1 = cell_y0 + GAS_TILE_SIZE;
+        if (cell_y1 > g_grid_height) cell_y1 = g_grid_height;
+
+        for (int tx = 0; tx < g_tile_cols; tx++) {
+            if (g_tile_converged[ty * g_tile_cols + tx]) continue;
+
+            int cell_x0 = tx * GAS_TILE_SIZE;
+            int cell_x1 = cell_x0 + GAS_TILE_SIZE;
+            if (cell_x1 > g_grid_width) cell_x1 = g_grid_width;
+
+            int pending = 0;
+            for (int gy = cell_y0; gy < cell_y1; gy++) {
+                int offset = gy * g_grid_width + cell_x0;
+                pending |= blend_row(&g_oxygen_grid[offset], &g_oxygen_target[offset],
+                                     cell_x1 - cell_x0);
+            }
+
+            if (!pending) {
+                g_tile_converged[ty * g_tile_cols + tx] = 1;
+            }
         }
     }
 }
 
+#ifndef HEADLESS_BUILD
 static void value_to_oxygen_color(float value, int* r, int* g, int* b) {
     // Heatmap: black -> dark blue -> blue -> cyan -> yellow -> red
     if (value < 0.0f) value = 0.0f;
@@ -313,4 +548,5 @@ void gas_render(void) {
             }
         }
     }
-}
\ No newline at end of file
+}
+#endif // HEADLESS_BUILD
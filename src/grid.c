@@ -5,32 +5,90 @@
 #include "types.h"
 #include "grid.h"
 #include "simulation.h"
+#include "lazy_alloc.h"
 
 // Spatial partitioning grid for efficient collision detection
 static GridCell* g_grid = NULL;
 static int g_grid_width = 0;
 static int g_grid_height = 0;
 
+// Index of populated cells so physics can skip empty world regions
+static int* g_occupied_cells = NULL;
+static int g_occupied_count = 0;
+static unsigned char* g_cell_listed = NULL;
+
+// Current cell of each node for incremental updates. Lazily committed,
+// stored as linear cell + 1 so zero-filled pages mean "not in grid".
+static LazyBuffer g_node_cell_buffer;
+static int* g_node_cell = NULL;
+
 int grid_init(void) {
     g_grid_width = (int)ceil(WORLD_WIDTH / GRID_SIZE);
     g_grid_height = (int)ceil(WORLD_HEIGHT / GRID_SIZE);
-    
+
     g_grid = (GridCell*)calloc(g_grid_width * g_grid_height, sizeof(GridCell));
-    
+
     if (!g_grid) {
         printf("Failed to allocate spatial grid\n");
         return 0;
     }
-    
+
+    g_occupied_cells = (int*)calloc(g_grid_width * g_grid_height, sizeof(int));
+
+    if (!g_occupied_cells) {
+        printf("Failed to allocate occupied cell index\n");
+        free(g_grid);
+        g_grid = NULL;
+        return 0;
+    }
+
+    g_cell_listed = (unsigned char*)calloc(g_grid_width * g_grid_height, sizeof(unsigned char));
+
+    if (!g_cell_listed) {
+        printf("Failed to allocate occupied cell flags\n");
+        free(g_occupied_cells);
+        g_occupied_cells = NULL;
+        free(g_grid);
+        g_grid = NULL;
+        return 0;
+    }
+
+    if (!lazy_buffer_init(&g_node_cell_buffer, sizeof(int), MAX_NODES)) {
+        printf("Failed to allocate node cell index\n");
+        free(g_cell_listed);
+        g_cell_listed = NULL;
+        free(g_occupied_cells);
+        g_occupied_cells = NULL;
+        free(g_grid);
+        g_grid = NULL;
+        return 0;
+    }
+    g_node_cell = (int*)g_node_cell_buffer.base;
+
     printf("Grid initialized: %dx%d cells\n", g_grid_width, g_grid_height);
     return 1;
 }
 
 void grid_cleanup(void) {
     if (g_grid) {
+        for (int i = 0; i < g_grid_width * g_grid_height; i++) {
+            free(g_grid[i].node_indices);
+            free(g_grid[i].corpse_indices);
+        }
         free(g_grid);
         g_grid = NULL;
     }
+    if (g_occupied_cells) {
+        free(g_occupied_cells);
+        g_occupied_cells = NULL;
+    }
+    if (g_cell_listed) {
+        free(g_cell_listed);
+        g_cell_listed = NULL;
+    }
+    lazy_buffer_cleanup(&g_node_cell_buffer);
+    g_node_cell = NULL;
+    g_occupied_count = 0;
 }
 
 static GridCell* get_grid_cell(int grid_x, int grid_y) {
@@ -48,11 +106,18 @@ static void world_to_grid(float world_x, float world_y, int* grid_x, int* grid_y
 
 void grid_clear(void) {
     if (!g_grid) return;
-    
-    int total_cells = g_grid_width * g_grid_height;
-    for (int i = 0; i < total_cells; i++) {
-        g_grid[i].count = 0;
+
+    // Only reset cells that were actually populated last frame
+    for (int i = 0; i < g_occupied_count; i++) {
+        GridCell* cell = &g_grid[g_occupied_cells[i]];
+        for (int n = 0; n < cell->count; n++) {
+            g_node_cell[cell->node_indices[n]] = 0;
+        }
+        cell->count = 0;
+        cell->corpse_count = 0;
+        g_cell_listed[g_occupied_cells[i]] = 0;
     }
+    g_occupied_count = 0;
 }
 
 void grid_add_node(int node_index) {
@@ -64,8 +129,95 @@ void grid_add_node(int node_index) {
     world_to_grid(nodes[node_index].x, nodes[node_index].y, &grid_x, &grid_y);
     
     GridCell* cell = get_grid_cell(grid_x, grid_y);
-    if (cell && cell->count < MAX_NODES_PER_CELL) {
-        cell->node_indices[cell->count++] = node_index;
+    if (!cell) return;
+
+    // Grow the cell's index storage on demand so dense clusters never
+    // drop nodes; capacity is retained across grid_clear
+    if (cell->count >= cell->capacity) {
+        int new_capacity = cell->capacity > 0 ? cell->capacity * 2 : 16;
+        int* new_indices = (int*)realloc(cell->node_indices, new_capacity * sizeof(int));
+        if (!new_indices) return;
+        cell->node_indices = new_indices;
+        cell->capacity = new_capacity;
+    }
+
+    if (!lazy_buffer_ensure(&g_node_cell_buffer, (size_t)node_index + 1)) return;
+    int linear = grid_y * g_grid_width + grid_x;
+    if (!g_cell_listed[linear]) {
+        g_cell_listed[linear] = 1;
+        g_occupied_cells[g_occupied_count++] = linear;
+    }
+    cell->node_indices[cell->count++] = node_index;
+    g_node_cell[node_index] = linear + 1;
+
+    // Corpses are mirrored into their own lane (plant_type -2 is set
+    // at spawn, before the node first enters the grid); the lane grows
+    // like the main one so mass die-offs never drop corpses
+    if (nodes[node_index].plant_type == -2) {
+        if (cell->corpse_count >= cell->corpse_capacity) {
+            int new_capacity = cell->corpse_capacity > 0 ? cell->corpse_capacity * 2 : 8;
+            int* new_corpses = (int*)realloc(cell->corpse_indices, new_capacity * sizeof(int));
+            if (!new_corpses) return;
+            cell->corpse_indices = new_corpses;
+            cell->corpse_capacity = new_capacity;
+        }
+        cell->corpse_indices[cell->corpse_count++] = node_index;
+    }
+}
+
+// Remove a node from the cell it is currently registered in
+static void remove_node_from_cell(int node_index, int linear_cell) {
+    GridCell* cell = &g_grid[linear_cell];
+    for (int n = 0; n < cell->count; n++) {
+        if (cell->node_indices[n] == node_index) {
+            cell->node_indices[n] = cell->node_indices[cell->count - 1];
+            cell->count--;
+            break;
+        }
+    }
+    for (int n = 0; n < cell->corpse_count; n++) {
+        if (cell->corpse_indices[n] == node_index) {
+            cell->corpse_indices[n] = cell->corpse_indices[cell->corpse_count - 1];
+            cell->corpse_count--;
+            break;
+        }
+    }
+    g_node_cell[node_index] = 0;
+}
+
+void grid_update_node(int node_index) {
+    Node* nodes = simulation_get_nodes();
+    if (node_index < 0 || node_index >= simulation_get_node_count()) return;
+
+    int old_cell = -1;
+    if ((size_t)node_index < g_node_cell_buffer.committed) {
+        old_cell = g_node_cell[node_index] - 1;
+    }
+
+    if (!nodes[node_index].active) {
+        if (old_cell >= 0) {
+            remove_node_from_cell(node_index, old_cell);
+        }
+        return;
+    }
+
+    int grid_x, grid_y;
+    world_to_grid(nodes[node_index].x, nodes[node_index].y, &grid_x, &grid_y);
+
+    int new_cell = -1;
+    if (grid_x >= 0 && grid_x < g_grid_width &&
+        grid_y >= 0 && grid_y < g_grid_height) {
+        new_cell = grid_y * g_grid_width + grid_x;
+    }
+
+    // Only touch cell lists when the node crossed a cell boundary
+    if (new_cell == old_cell) return;
+
+    if (old_cell >= 0) {
+        remove_node_from_cell(node_index, old_cell);
+    }
+    if (new_cell >= 0) {
+        grid_add_node(node_index);
     }
 }
 
@@ -82,6 +234,28 @@ void grid_rebuild(void) {
     }
 }
 
+GridCell* grid_get_cell(int grid_x, int grid_y) {
+    return get_grid_cell(grid_x, grid_y);
+}
+
+int grid_get_width(void) {
+    return g_grid_width;
+}
+
+int grid_get_height(void) {
+    return g_grid_height;
+}
+
+int grid_get_occupied_count(void) {
+    return g_occupied_count;
+}
+
+void grid_get_occupied_cell_coords(int occupied_index, int* grid_x, int* grid_y) {
+    int linear = g_occupied_cells[occupied_index];
+    *grid_x = linear % g_grid_width;
+    *grid_y = linear / g_grid_width;
+}
+
 int grid_get_cells_at_position(float world_x, float world_y, GridCell** cells, int max_cells) {
     int grid_x, grid_y;
     world_to_grid(world_x, world_y, &grid_x, &grid_y);
@@ -0,0 +1,96 @@
+// For MAP_ANONYMOUS under -std=c99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include "lazy_alloc.h"
+
+// Commit granularity: one slab of pages per growth step
+#define LAZY_SLAB_BYTES (4 * 1024 * 1024)
+
+static size_t round_up(size_t value, size_t granularity) {
+    return ((value + granularity - 1) / granularity) * granularity;
+}
+
+int lazy_buffer_init(LazyBuffer* buffer, size_t element_size, size_t max_elements) {
+    buffer->base = NULL;
+    buffer->element_size = element_size;
+    buffer->capacity = max_elements;
+    buffer->committed = 0;
+    buffer->reserved_bytes = round_up(element_size * max_elements, LAZY_SLAB_BYTES);
+
+#ifdef _WIN32
+    buffer->base = VirtualAlloc(NULL, buffer->reserved_bytes, MEM_RESERVE, PAGE_NOACCESS);
+    if (!buffer->base) {
+        printf("Failed to reserve %zu MB of address space\n",
+               buffer->reserved_bytes / (1024 * 1024));
+        return 0;
+    }
+#else
+    buffer->base = mmap(NULL, buffer->reserved_bytes, PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer->base == MAP_FAILED) {
+        buffer->base = NULL;
+        printf("Failed to reserve %zu MB of address space\n",
+               buffer->reserved_bytes / (1024 * 1024));
+        return 0;
+    }
+#endif
+
+    return 1;
+}
+
+void lazy_buffer_cleanup(LazyBuffer* buffer) {
+    if (!buffer->base) return;
+
+#ifdef _WIN32
+    VirtualFree(buffer->base, 0, MEM_RELEASE);
+#else
+    munmap(buffer->base, buffer->reserved_bytes);
+#endif
+
+    buffer->base = NULL;
+    buffer->committed = 0;
+}
+
+int lazy_buffer_ensure(LazyBuffer* buffer, size_t element_count) {
+    if (!buffer->base) return 0;
+    if (element_count <= buffer->committed) return 1;
+    if (element_count > buffer->capacity) return 0;
+
+    size_t committed_bytes = round_up(buffer->committed * buffer->element_size,
+                                      LAZY_SLAB_BYTES);
+    size_t needed_bytes = round_up(element_count * buffer->element_size,
+                                   LAZY_SLAB_BYTES);
+    if (needed_bytes > buffer->reserved_bytes) needed_bytes = buffer->reserved_bytes;
+
+    if (needed_bytes > committed_bytes) {
+        char* start = (char*)buffer->base + committed_bytes;
+        size_t length = needed_bytes - committed_bytes;
+
+#ifdef _WIN32
+        if (!VirtualAlloc(start, length, MEM_COMMIT, PAGE_READWRITE)) {
+            printf("Failed to commit %zu KB slab\n", length / 1024);
+            return 0;
+        }
+#else
+        if (mprotect(start, length, PROT_READ | PROT_WRITE) != 0) {
+            printf("Failed to commit %zu KB slab\n", length / 1024);
+            return 0;
+        }
+#endif
+    }
+
+    // Track committed elements (whole slabs may cover more than asked)
+    buffer->committed = needed_bytes / buffer->element_size;
+    if (buffer->committed > buffer->capacity) buffer->committed = buffer->capacity;
+
+    return 1;
+}
@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "types.h"
+#include "lod.h"
+#include "simulation.h"
+#include "fish.h"
+#ifndef HEADLESS_BUILD
+#include "camera.h"
+#endif
+
+// Per-region scheduling state. A region is "active" (full rate) when
+// the viewport overlaps it or a fish sits in or next to it; everything
+// else runs every LOD_DORMANT_INTERVAL-th frame, staggered by region
+// index so dormant work spreads evenly across frames.
+static unsigned char* g_region_active = NULL;
+static int* g_region_pending = NULL;   // Frames banked since the last update
+static int* g_region_steps = NULL;     // Steps granted for the current frame
+static int g_region_cols = 0;
+static int g_region_rows = 0;
+
+int lod_init(void) {
+    g_region_cols = (int)ceil(WORLD_WIDTH / LOD_REGION_SIZE);
+    g_region_rows = (int)ceil(WORLD_HEIGHT / LOD_REGION_SIZE);
+
+    int region_count = g_region_cols * g_region_rows;
+    g_region_active = calloc(region_count, sizeof(unsigned char));
+    g_region_pending = calloc(region_count, sizeof(int));
+    g_region_steps = malloc(region_count * sizeof(int));
+
+    if (!g_region_active || !g_region_pending || !g_region_steps) {
+        printf("Failed to allocate LOD regions\n");
+        lod_cleanup();
+        return 0;
+    }
+
+    // Everything runs full rate until the first priority pass
+    for (int i = 0; i < region_count; i++) {
+        g_region_steps[i] = 1;
+    }
+
+    printf("LOD scheduler initialized: %dx%d regions (%.0f unit cells, 1/%d dormant rate)\n",
+           g_region_cols, g_region_rows, LOD_REGION_SIZE, LOD_DORMANT_INTERVAL);
+    return 1;
+}
+
+void lod_cleanup(void) {
+    if (g_region_active) {
+        free(g_region_active);
+        g_region_active = NULL;
+    }
+    if (g_region_pending) {
+        free(g_region_pending);
+        g_region_pending = NULL;
+    }
+    if (g_region_steps) {
+        free(g_region_steps);
+        g_region_steps = NULL;
+    }
+}
+
+static void mark_region_block(int min_x, int min_y, int max_x, int max_y) {
+    if (min_x < 0) min_x = 0;
+    if (min_y < 0) min_y = 0;
+    if (max_x >= g_region_cols) max_x = g_region_cols - 1;
+    if (max_y >= g_region_rows) max_y = g_region_rows - 1;
+
+    for (int ry = min_y; ry <= max_y; ry++) {
+        for (int rx = min_x; rx <= max_x; rx++) {
+            g_region_active[ry * g_region_cols + rx] = 1;
+        }
+    }
+}
+
+void lod_update(void) {
+    if (!g_region_active) return;
+
+    int region_count = g_region_cols * g_region_rows;
+    memset(g_region_active, 0, region_count * sizeof(unsigned char));
+
+#ifndef HEADLESS_BUILD
+    // Regions on screen (plus one ring of margin) run at full rate
+    float view_left, view_top, view_right, view_bottom;
+    camera_get_viewport_bounds(&view_left, &view_top, &view_right, &view_bottom);
+
+    mark_region_block((int)floor((view_left - WORLD_LEFT) / LOD_REGION_SIZE) - 1,
+                      (int)floor((view_top - WORLD_TOP) / LOD_REGION_SIZE) - 1,
+                      (int)floor((view_right - WORLD_LEFT) / LOD_REGION_SIZE) + 1,
+                      (int)floor((view_bottom - WORLD_TOP) / LOD_REGION_SIZE) + 1);
+#endif
+
+    // Regions holding fish (plus one ring so food and corpses in reach
+    // stay responsive) run at full rate
+    Node* nodes = simulation_get_nodes();
+    int node_count = simulation_get_node_count();
+    Fish* all_fish = fish_get_all();
+    int highest_slot = fish_get_highest_slot();
+
+    for (int i = 0; i <= highest_slot; i++) {
+        if (!all_fish[i].active) continue;
+
+        int node_id = all_fish[i].node_id;
+        if (node_id < 0 || node_id >= node_count) continue;
+        if (!nodes[node_id].active) continue;
+
+        int rx = (int)floor((nodes[node_id].x - WORLD_LEFT) / LOD_REGION_SIZE);
+        int ry = (int)floor((nodes[node_id].y - WORLD_TOP) / LOD_REGION_SIZE);
+        mark_region_block(rx - 1, ry - 1, rx + 1, ry + 1);
+    }
+
+    // Grant banked steps: active regions run every frame, dormant ones
+    // on their staggered slot with all skipped frames applied at once
+    int frame = simulation_get_frame_counter();
+    for (int i = 0; i < region_count; i++) {
+        g_region_pending[i]++;
+
+        if (g_region_active[i] || (frame + i) % LOD_DORMANT_INTERVAL == 0) {
+            g_region_steps[i] = g_region_pending[i];
+            g_region_pending[i] = 0;
+        } else {
+            g_region_steps[i] = 0;
+        }
+    }
+}
+
+int lod_region_steps(float world_x, float world_y) {
+    if (!g_region_steps) return 1;
+
+    int rx = (int)floor((world_x - WORLD_LEFT) / LOD_REGION_SIZE);
+    int ry = (int)floor((world_y - WORLD_TOP) / LOD_REGION_SIZE);
+
+    if (rx < 0) rx = 0;
+    if (rx >= g_region_cols) rx = g_region_cols - 1;
+    if (ry < 0) ry = 0;
+    if (ry >= g_region_rows) ry = g_region_rows - 1;
+
+    return g_region_steps[ry * g_region_cols + rx];
+}
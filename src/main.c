@@ -1,4 +1,6 @@
+#ifndef HEADLESS_BUILD
 #include <SDL2/SDL.h>
+#endif
 #include <stdio.h>
 #include <time.h>
 #include <stdlib.h>
@@ -6,46 +8,87 @@
 
 #include "types.h"
 #include "simulation.h"
-#include "camera.h"
 #include "plants.h"
 #include "fish.h"
+#include "fish_brain.h"
 #include "python_api.h"
 #include "physics.h"
+#ifndef HEADLESS_BUILD
+#include "camera.h"
 #include "rendering.h"
+#endif
 #include "nutrition.h"
 #include "gas.h"
 #include "flow.h"
 #include "temperature.h"
+#include "bench.h"
+#include "farm.h"
+#include "profiler.h"
+#include "stats_shm.h"
+#include "telemetry.h"
+#include "snapshot.h"
+#include "lod.h"
 
 #define FRAME_DELAY (1000 / TARGET_FPS)
 
+// Maximum simulation steps per rendered frame
+#define MAX_SIM_SPEED 64
+
 // Global application state
+#ifndef HEADLESS_BUILD
 static int g_current_plant_type = 0;
 static int g_current_fish_type = 0;
 static int g_spawn_mode = 0; // 0 = plants, 1 = fish
+static int g_sim_speed_multiplier = 1; // simulation steps per rendered frame
+#endif
 static int g_graceful_shutdown_requested = 0;
 
+#ifndef HEADLESS_BUILD
 // FPS tracking
 static Uint32 g_frame_count = 0;
 static Uint32 g_fps_start_time = 0;
+#endif
 
 // Handle Ctrl+C gracefully to save neural network models
 static void signal_handler(int signum) {
     printf("\nReceived signal %d, initiating graceful shutdown for model saving...\n", signum);
     g_graceful_shutdown_requested = 1;
-    remove("simulation_stats.tmp");
-    printf("Cleaned up simulation_stats.tmp\n");
 }
 
+#ifdef HEADLESS_BUILD
+static int count_active_fish(void);
+
+// Report simulation throughput every few wall-clock seconds
+static void update_fps(void) {
+    static time_t last_report = 0;
+    static int frames_since_report = 0;
+
+    frames_since_report++;
+    time_t now = time(NULL);
+
+    if (last_report == 0) {
+        last_report = now;
+        return;
+    }
+
+    if (now - last_report >= 5) {
+        printf("Headless throughput: %.1f frames/sec (frame %d, fish %d)\n",
+               (float)frames_since_report / (float)(now - last_report),
+               simulation_get_frame_counter(), count_active_fish());
+        frames_since_report = 0;
+        last_report = now;
+    }
+}
+#else
 // Calculate and display FPS every second
 static void update_fps(void) {
     g_frame_count++;
     Uint32 current_time = SDL_GetTicks();
-    
+
     if (g_fps_start_time == 0) {
         g_fps_start_time = current_time;
     }
-    
+
     Uint32 elapsed = current_time - g_fps_start_time;
     if (elapsed >= 1000) {
         float fps = (float)g_frame_count * 1000.0f / (float)elapsed;
@@ -54,6 +97,7 @@ static void update_fps(void) {
         g_fps_start_time = current_time;
     }
 }
+#endif
 
 // Create initial ecosystem population
 static void populate_reef_randomly(void) {
@@ -110,35 +154,28 @@ static int count_active_fish(void) {
     return active_count;
 }
 
-// Write statistics to file for external monitoring (temperature control GUI)
+// Publish statistics for external monitoring (temperature control GUI)
 static void write_stats_file(void) {
     static int last_write_frame = 0;
     int current_frame = simulation_get_frame_counter();
-    
-    // Update every second only
+
+    // Temperature control from the Python GUI: a cheap shared-memory
+    // read, so poll it every frame
+    float new_temp;
+    if (stats_shm_poll_temperature(&new_temp)) {
+        temperature_set_current(new_temp);
+    }
+
+    // Counting nodes is O(world), so refresh the snapshot once a second
     if (current_frame - last_write_frame < 30) {
         return;
     }
     last_write_frame = current_frame;
-    
-    // Check for temperature control from Python GUI
-    FILE* temp_control = fopen("temperature_control.tmp", "r");
-    if (temp_control) {
-        char line[32];
-        if (fgets(line, sizeof(line), temp_control)) {
-            float new_temp = atof(line);
-            temperature_set_current(new_temp);
-        }
-        fclose(temp_control);
-    }
-    
-    FILE* stats_file = fopen("simulation_stats.tmp", "wb");
-    if (!stats_file) return;
-    
+
     // Collect current statistics
     int fish_count = count_active_fish();
     int plant_count = 0;
-    
+
     Node* nodes = simulation_get_nodes();
     int node_count = simulation_get_node_count();
     for (int i = 0; i < node_count; i++) {
@@ -146,24 +183,59 @@ static void write_stats_file(void) {
             plant_count++;
         }
     }
-    
+
     float total_environmental_nutrition = plants_get_total_environmental_nutrition();
     float current_temperature = temperature_get_current();
-    
+
     int bleached_count = 0;
     for (int i = 0; i < node_count; i++) {
         if (nodes[i].active && temperature_is_coral_bleached(i)) {
             bleached_count++;
         }
     }
-    
-    // Write binary data for external monitoring
-    float data[5] = {total_environmental_nutrition, (float)fish_count, (float)plant_count, 
-                     current_temperature, (float)bleached_count};
-    fwrite(data, sizeof(float), 5, stats_file);
-    fclose(stats_file);
+
+    stats_shm_publish(total_environmental_nutrition, fish_count, plant_count,
+                      current_temperature, bleached_count);
+}
+
+// Advance the ecosystem by one frame. Returns 0 when a benchmark run
+// has reached its frame limit.
+static int run_simulation_step(void) {
+    // Refresh region priorities before the consumers bank their steps
+    lod_update();
+
+    profiler_stage_begin(PROF_STAGE_BRAIN);
+    fish_brain_update();  // Native neural network inference
+    profiler_stage_end(PROF_STAGE_BRAIN);
+    if (simulation_get_frame_counter() % PYTHON_UPDATE_INTERVAL == 0) {
+        profiler_stage_begin(PROF_STAGE_PYTHON);
+        python_api_update();  // Python training and inheritance
+        profiler_stage_end(PROF_STAGE_PYTHON);
+    }
+    profiler_stage_begin(PROF_STAGE_FISH);
+    fish_update();        // Fish behavior and aging
+    profiler_stage_end(PROF_STAGE_FISH);
+    physics_update();     // Physics simulation and plant growth
+    profiler_stage_begin(PROF_STAGE_TEMPERATURE);
+    temperature_process_coral_bleaching();  // Coral bleaching from temperature
+    profiler_stage_end(PROF_STAGE_TEMPERATURE);
+
+    write_stats_file();   // Export data for external monitoring
+    telemetry_record_frame();  // Stage this frame's metrics for the log
+
+    // Fold this step's stage timings into the rolling window
+    profiler_frame_end();
+
+    if (bench_is_active() && bench_frame_done()) {
+        return 0;
+    }
+    if (farm_is_worker() && farm_frame_done()) {
+        return 0;
+    }
+    return 1;
 }
 
+#ifndef HEADLESS_BUILD
 // Launch external statistics monitor with temperature control
 static void start_stats_plotter(void) {
     printf("Starting ecosystem statistics monitor with temperature control...\n");
@@ -175,7 +247,7 @@ static void start_stats_plotter(void) {
     #endif
     
     printf("Statistics monitor started! Live plots should appear with temperature slider.\n");
-    printf("Data is updated every second via simulation_stats.tmp\n");
+    printf("Data is shared through simulation_stats.shm\n");
     printf("You can close and reopen the statistics window anytime with TAB\n");
 }
 
@@ -243,6 +315,7 @@ static void print_debug_info(void) {
     printf("Active fish: %d\n", count_active_fish());
     printf("Total nodes: %d\n", simulation_get_node_count());
     printf("Spawn mode: %s\n", g_spawn_mode == 0 ? "PLANT" : "FISH");
+    printf("Simulation speed: %dx\n", g_sim_speed_multiplier);
     printf("Ray rendering: %s\n", fish_is_ray_rendering_enabled() ? "ON" : "OFF");
     printf("Flow field: %s\n", flow_is_visible() ? "ON" : "OFF");
     printf("Temperature: %.1f°C\n", temperature_get_current());
@@ -318,11 +391,9 @@ static void print_debug_info(void) {
     printf("Training is ongoing - reproduction success tracked for model selection\n");
     printf("==========================================\n\n");
 }
+#endif // HEADLESS_BUILD
 
 int main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
-    
     printf("Starting Great Barrier Reef Ecosystem v3...\n");
     printf("World dimensions: %.0fx%.0f, Initial population: %d plants, %d fish\n",
            WORLD_WIDTH, WORLD_HEIGHT, INITIAL_PLANT_COUNT, INITIAL_FISH_COUNT);
@@ -331,12 +402,28 @@ int main(int argc, char* argv[]) {
     printf("Best models will be saved on graceful shutdown (Ctrl+C)\n");
     printf("Live statistics plotter available with temperature control (press 'TAB')\n");
     
-    srand((unsigned int)time(NULL));
-    
+    // Benchmark mode uses a fixed seed so runs are reproducible
+    if (bench_parse_args(argc, argv)) {
+        srand(bench_get_seed());
+    } else if (farm_parse_args(argc, argv)) {
+        // The farm parent only orchestrates workers; each worker gets
+        // its own seed so the worlds diverge
+        if (farm_is_parent()) {
+            return farm_run_parent(argv[0]);
+        }
+        srand(farm_get_seed());
+    } else {
+        srand((unsigned int)time(NULL));
+    }
+
+    // Optional streaming metrics log, orthogonal to the run mode
+    telemetry_parse_args(argc, argv);
+
     // Enable graceful shutdown for neural network model saving
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
-    
+
+#ifndef HEADLESS_BUILD
     // Initialize SDL
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         printf("SDL init failed: %s\n", SDL_GetError());
@@ -361,13 +448,17 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    
+#else
+    printf("Running in headless mode - no window, uncapped simulation rate\n");
+#endif
+
     // Initialize all core systems
     printf("Initializing systems...\n");
     if (!simulation_init()) {
         printf("Simulation init failed\n");
         goto cleanup;
     }
+#ifndef HEADLESS_BUILD
     if (!camera_init()) {
         printf("Camera init failed\n");
         goto cleanup;
@@ -376,6 +467,7 @@ int main(int argc, char* argv[]) {
         printf("Rendering init failed\n");
         goto cleanup;
     }
+#endif
     if (!nutrition_init()) {
         printf("Nutrition init failed\n");
         goto cleanup;
@@ -396,7 +488,27 @@ int main(int argc, char* argv[]) {
         printf("Temperature init failed\n");
         goto cleanup;
     }
-    
+    if (!physics_init()) {
+        printf("Physics init failed\n");
+        goto cleanup;
+    }
+    if (!lod_init()) {
+        printf("LOD scheduler init failed\n");
+        goto cleanup;
+    }
+    if (!fish_brain_init()) {
+        printf("Fish brain init failed\n");
+        goto cleanup;
+    }
+    if (!stats_shm_init()) {
+        printf("Stats shared memory init failed\n");
+        goto cleanup;
+    }
+    if (!telemetry_init()) {
+        printf("Telemetry init failed\n");
+        goto cleanup;
+    }
+
     // Load ecosystem configurations
     printf("Loading configurations...\n");
     if (!plants_load_config("plants.conf")) {
@@ -423,14 +535,20 @@ int main(int argc, char* argv[]) {
     }
     
     printf("Python neural network controller loaded successfully!\n");
-    
+
+#ifndef HEADLESS_BUILD
     // Set renderer for visual layers
     nutrition_set_renderer(renderer);
     gas_set_renderer(renderer);
     flow_set_renderer(renderer);
-    
+#endif
+
     // Create initial ecosystem
-    populate_reef_randomly();
+    if (bench_is_active()) {
+        bench_setup_scenario();
+    } else {
+        populate_reef_randomly();
+    }
     
     // Print system status
     printf("\nSystem ready!\n");
@@ -438,7 +556,8 @@ int main(int argc, char* argv[]) {
     printf("Fish types loaded: %d\n", fish_get_type_count());
     printf("Temperature: %.1f°C (use stats GUI to adjust)\n", temperature_get_current());
     printf("Standard nutrition depletion range: %.1f\n", STANDARD_DEPLETION_RANGE);
-    
+
+#ifndef HEADLESS_BUILD
     // Print user controls
     printf("\nControls:\n");
     printf("  Left click: Create organism\n");
@@ -455,23 +574,31 @@ int main(int argc, char* argv[]) {
     printf("  F: Toggle flow field\n");
     printf("  R: Toggle fish vision rays\n");
     printf("  P: Print debug info\n");
+    printf("  +/-: Double/halve simulation speed (up to %dx)\n", MAX_SIM_SPEED);
+    printf("  F9/F10: Save/load world snapshot (%s)\n", SNAPSHOT_DEFAULT_FILE);
     printf("  ESC or Ctrl+C: Save best models and exit (cleans temp files)\n\n");
     
     // Set initial mode
     if (plants_get_type_count() > 0) {
         printf("Mode: PLANT (%s)\n", plants_get_type(0)->name);
     }
-    
+#endif
+
     // Main simulation loop
     int running = 1;
+#ifndef HEADLESS_BUILD
     SDL_Event event;
     int mouse_x = 0, mouse_y = 0;
-    
+
     printf("Use the statistics GUI (TAB) to monitor live population and temperature.\n\n");
-    
+#else
+    printf("Simulation running - press Ctrl+C to stop and save models.\n\n");
+#endif
+
     while (running && !g_graceful_shutdown_requested) {
+#ifndef HEADLESS_BUILD
         Uint32 frame_start = SDL_GetTicks();
-        
+
         // Camera movement input
         const Uint8* keys = SDL_GetKeyboardState(NULL);
         int movement_keys[4] = {
@@ -531,7 +658,31 @@ int main(int argc, char* argv[]) {
                         case SDLK_p:
                             print_debug_info();
                             break;
-                            
+
+                        // Simulation speed control (doubling steps)
+                        case SDLK_PLUS: case SDLK_KP_PLUS: case SDLK_EQUALS:
+                            if (g_sim_speed_multiplier < MAX_SIM_SPEED) {
+                                g_sim_speed_multiplier *= 2;
+                            }
+                            printf("Simulation speed: %dx (%d steps per rendered frame)\n",
+                                   g_sim_speed_multiplier, g_sim_speed_multiplier);
+                            break;
+                        case SDLK_MINUS: case SDLK_KP_MINUS:
+                            if (g_sim_speed_multiplier > 1) {
+                                g_sim_speed_multiplier /= 2;
+                            }
+                            printf("Simulation speed: %dx (%d steps per rendered frame)\n",
+                                   g_sim_speed_multiplier, g_sim_speed_multiplier);
+                            break;
+
+                        // World snapshot checkpointing
+                        case SDLK_F9:
+                            snapshot_save(SNAPSHOT_DEFAULT_FILE);
+                            break;
+                        case SDLK_F10:
+                            snapshot_load(SNAPSHOT_DEFAULT_FILE);
+                            break;
+
                         // Plant type selection (1-8)
                         case SDLK_1: case SDLK_2: case SDLK_3: case SDLK_4:
                         case SDLK_5: case SDLK_6: case SDLK_7: case SDLK_8: {
@@ -578,34 +729,56 @@ int main(int argc, char* argv[]) {
                     break;
             }
         }
-        
+
         // Update all systems each frame
         camera_update_with_sprint(movement_keys, sprint);
-        python_api_update();  // Neural network updates
-        fish_update();        // Fish behavior and aging
-        physics_update();     // Physics simulation and plant growth
-        temperature_process_coral_bleaching();  // Coral bleaching from temperature
-        
+
+        // Run the configured number of simulation steps per rendered
+        // frame; the renderer samples the latest state at display rate
+        for (int step = 0; step < g_sim_speed_multiplier && running; step++) {
+            if (!run_simulation_step()) {
+                running = 0;
+            }
+            if (g_graceful_shutdown_requested) break;
+        }
+
         update_fps();
-        write_stats_file();   // Export data for external monitoring
+        profiler_stage_begin(PROF_STAGE_RENDER);
         rendering_render();   // Draw everything
-        
-        // Maintain target framerate
+        profiler_stage_end(PROF_STAGE_RENDER);
+
+        // Maintain display framerate; the simulation outruns it by the
+        // speed multiplier (benchmarks run fully uncapped)
         Uint32 frame_time = SDL_GetTicks() - frame_start;
-        if (frame_time < FRAME_DELAY) {
+        if (!bench_is_active() && frame_time < FRAME_DELAY) {
             SDL_Delay(FRAME_DELAY - frame_time);
         }
+#else
+        if (!run_simulation_step()) {
+            running = 0;
+        }
+        update_fps();
+#endif
     }
-    
+
+    bench_report();
+
 cleanup:
     printf("Shutting down and saving neural network models...\n");
-    
-    remove("simulation_stats.tmp");
-    
+
+    stats_shm_cleanup();
+    telemetry_cleanup();
+
     // Allow Python time to save models gracefully
     if (g_graceful_shutdown_requested) {
         printf("Allowing Python to save best models...\n");
     }
+
+    // Farm workers save explicitly: they exit on a frame budget, so
+    // Python's signal handler never runs for them
+    if (farm_is_worker()) {
+        python_api_request_model_save();
+    }
     
     // Final ecosystem report
     printf("\n=== FINAL TRAINING REPORT ===\n");
@@ -633,6 +806,9 @@ cleanup:
     printf("========================================\n");
     
     // Cleanup all systems
+    fish_brain_cleanup();
+    lod_cleanup();
+    physics_cleanup();
     temperature_cleanup();
     python_api_cleanup();
     fish_cleanup();
@@ -640,12 +816,14 @@ cleanup:
     gas_cleanup();
     nutrition_cleanup();
     simulation_cleanup();
+#ifndef HEADLESS_BUILD
     rendering_cleanup();
-    
+
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
-    
+#endif
+
     printf("Training session complete! Models saved for future use.\n");
     return 0;
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <stdio.h>
 #include <math.h>
 
 #include "types.h"
@@ -6,122 +7,173 @@
 #include "grid.h"
 #include "plants.h"
 #include "fish.h"
+#include "worker_pool.h"
+#include "profiler.h"
 
-static void apply_repulsion_forces(void) {
+// Stripe partitioning state for the parallel repulsion solver
+static int g_repulsion_stripe_height = 0;
+static int g_repulsion_stripe_parity = 0;
+
+int physics_init(void) {
+    if (!worker_pool_init()) {
+        printf("Failed to initialize worker pool\n");
+        return 0;
+    }
+
+    printf("Physics initialized: repulsion solver using %d threads\n",
+           worker_pool_get_thread_count());
+    return 1;
+}
+
+void physics_cleanup(void) {
+    worker_pool_cleanup();
+}
+
+// Repulsion between two nodes in the same grid cell. Mobility comes
+// from the flat per-node cache so the pair loop never touches the
+// plant type table.
+static void resolve_same_cell_pair(Node* nodes, const float* mobility,
+                                   int node_count, int i, int j) {
+    float optimal_sq = OPTIMAL_DISTANCE * OPTIMAL_DISTANCE;
+
+    if (i < 0 || i >= node_count || j < 0 || j >= node_count) return;
+    if (!nodes[i].active || !nodes[j].active) return;
+
+    float dx = nodes[j].x - nodes[i].x;
+    float dy = nodes[j].y - nodes[i].y;
+    float distance_sq = dx * dx + dy * dy;
+
+    if (distance_sq < optimal_sq && distance_sq > 0) {
+        float distance = sqrt(distance_sq);
+        float force_magnitude = REPULSION_FORCE * (OPTIMAL_DISTANCE - distance) / distance;
+        float fx = -dx * force_magnitude;
+        float fy = -dy * force_magnitude;
+
+        nodes[i].vx += fx * mobility[i];
+        nodes[i].vy += fy * mobility[i];
+        nodes[j].vx -= fx * mobility[j];
+        nodes[j].vy -= fy * mobility[j];
+    }
+}
+
+// Repulsion between two nodes in neighboring grid cells
+static void resolve_cross_cell_pair(Node* nodes, const float* mobility,
+                                    const float* repulsion,
+                                    int node_count, int i, int j) {
     float optimal_sq = OPTIMAL_DISTANCE * OPTIMAL_DISTANCE;
+
+    if (i < 0 || i >= node_count || j < 0 || j >= node_count) return;
+    if (!nodes[i].active || !nodes[j].active) return;
+
+    float dx = nodes[j].x - nodes[i].x;
+    float dy = nodes[j].y - nodes[i].y;
+    float distance_sq = dx * dx + dy * dy;
+
+    if (distance_sq < optimal_sq && distance_sq > 0) {
+        float distance = sqrt(distance_sq);
+        float base_force = REPULSION_FORCE * (OPTIMAL_DISTANCE - distance) / distance;
+
+        // Static plants create stronger repulsion (cached as 2 - mobility)
+        float fx = -dx * base_force * repulsion[j];
+        float fy = -dy * base_force * repulsion[j];
+        float fx2 = dx * base_force * repulsion[i];
+        float fy2 = dy * base_force * repulsion[i];
+
+        nodes[i].vx += fx * mobility[i];
+        nodes[i].vy += fy * mobility[i];
+        nodes[j].vx += fx2 * mobility[j];
+        nodes[j].vy += fy2 * mobility[j];
+    }
+}
+
+// Process all pair interactions for one row stripe of grid cells.
+// Each cell is paired against its forward neighbors (E, SW, S, SE) so
+// every cell pair is visited exactly once. A stripe only writes to nodes
+// in its own rows plus the first row of the stripe below, so stripes are
+// processed in two alternating passes (even stripes, then odd stripes)
+// to keep force accumulation conflict-free across threads.
+static void repulsion_stripe_task(int stripe_index, void* context) {
+    (void)context;
+
     Node* nodes = simulation_get_nodes();
+    const float* mobility = simulation_get_node_mobility();
+    const float* repulsion = simulation_get_node_repulsion();
     int node_count = simulation_get_node_count();
-    
-    // Process repulsion forces using spatial grid for efficiency
-    for (int gx = 0; gx < (int)ceil(WORLD_WIDTH / GRID_SIZE); gx++) {
-        for (int gy = 0; gy < (int)ceil(WORLD_HEIGHT / GRID_SIZE); gy++) {
-            GridCell* cells[9];
-            int cell_count = 0;
-            grid_get_nearby_cells(gx, gy, 1, cells, &cell_count, 9);
-            
-            // Check pairs within same cell
-            if (cell_count > 0) {
-                GridCell* cell = cells[0]; // Center cell
-                for (int a = 0; a < cell->count; a++) {
-                    for (int b = a + 1; b < cell->count; b++) {
-                        int i = cell->node_indices[a];
-                        int j = cell->node_indices[b];
-                        
-                        if (i < 0 || i >= node_count || j < 0 || j >= node_count) continue;
-                        if (!nodes[i].active || !nodes[j].active) continue;
-                        
-                        float dx = nodes[j].x - nodes[i].x;
-                        float dy = nodes[j].y - nodes[i].y;
-                        float distance_sq = dx * dx + dy * dy;
-                        
-                        if (distance_sq < optimal_sq && distance_sq > 0) {
-                            float distance = sqrt(distance_sq);
-                            float force_magnitude = REPULSION_FORCE * (OPTIMAL_DISTANCE - distance) / distance;
-                            float fx = -dx * force_magnitude;
-                            float fy = -dy * force_magnitude;
-                            
-                            // Apply mobility factor based on node type
-                            float mobility_i = 1.0f;
-                            float mobility_j = 1.0f;
-                            
-                            // Check if nodes are plants or fish
-                            if (nodes[i].plant_type >= 0) {
-                                PlantType* pt_i = plants_get_type(nodes[i].plant_type);
-                                if (pt_i) mobility_i = pt_i->mobility_factor;
-                            }
-                            
-                            if (nodes[j].plant_type >= 0) {
-                                PlantType* pt_j = plants_get_type(nodes[j].plant_type);
-                                if (pt_j) mobility_j = pt_j->mobility_factor;
-                            }
-                            
-                            nodes[i].vx += fx * mobility_i;
-                            nodes[i].vy += fy * mobility_i;
-                            nodes[j].vx -= fx * mobility_j;
-                            nodes[j].vy -= fy * mobility_j;
-                        }
-                    }
-                }
+    int grid_height = grid_get_height();
+    int occupied_count = grid_get_occupied_count();
+
+    int stripe = stripe_index * 2 + g_repulsion_stripe_parity;
+    int start_row = stripe * g_repulsion_stripe_height;
+    int end_row = start_row + g_repulsion_stripe_height;
+    if (end_row > grid_height) end_row = grid_height;
+
+    // Walk only populated cells so cost tracks population, not world area
+    for (int c = 0; c < occupied_count; c++) {
+        int gx, gy;
+        grid_get_occupied_cell_coords(c, &gx, &gy);
+        if (gy < start_row || gy >= end_row) continue;
+
+        GridCell* cell = grid_get_cell(gx, gy);
+        if (!cell || cell->count == 0) continue;
+
+        // Pairs within the same cell
+        for (int a = 0; a < cell->count; a++) {
+            for (int b = a + 1; b < cell->count; b++) {
+                resolve_same_cell_pair(nodes, mobility, node_count,
+                                       cell->node_indices[a],
+                                       cell->node_indices[b]);
             }
-            
-            // Check pairs with adjacent cells
-            for (int c = 1; c < cell_count; c++) {
-                GridCell* cell1 = cells[0];
-                GridCell* cell2 = cells[c];
-                
-                for (int a = 0; a < cell1->count; a++) {
-                    for (int b = 0; b < cell2->count; b++) {
-                        int i = cell1->node_indices[a];
-                        int j = cell2->node_indices[b];
-                        
-                        if (i < 0 || i >= node_count || j < 0 || j >= node_count) continue;
-                        if (!nodes[i].active || !nodes[j].active) continue;
-                        
-                        float dx = nodes[j].x - nodes[i].x;
-                        float dy = nodes[j].y - nodes[i].y;
-                        float distance_sq = dx * dx + dy * dy;
-                        
-                        if (distance_sq < optimal_sq && distance_sq > 0) {
-                            float distance = sqrt(distance_sq);
-                            float base_force = REPULSION_FORCE * (OPTIMAL_DISTANCE - distance) / distance;
-                            
-                            float mobility_i = 1.0f;
-                            float mobility_j = 1.0f;
-                            
-                            if (nodes[i].plant_type >= 0) {
-                                PlantType* pt_i = plants_get_type(nodes[i].plant_type);
-                                if (pt_i) mobility_i = pt_i->mobility_factor;
-                            }
-                            
-                            if (nodes[j].plant_type >= 0) {
-                                PlantType* pt_j = plants_get_type(nodes[j].plant_type);
-                                if (pt_j) mobility_j = pt_j->mobility_factor;
-                            }
-                            
-                            // Static plants create stronger repulsion
-                            float repulsion_strength_i = 2.0f - mobility_i;
-                            float repulsion_strength_j = 2.0f - mobility_j;
-                            
-                            float fx = -dx * base_force * repulsion_strength_j;
-                            float fy = -dy * base_force * repulsion_strength_j;
-                            float fx2 = dx * base_force * repulsion_strength_i;
-                            float fy2 = dy * base_force * repulsion_strength_i;
-                            
-                            nodes[i].vx += fx * mobility_i;
-                            nodes[i].vy += fy * mobility_i;
-                            nodes[j].vx += fx2 * mobility_j;
-                            nodes[j].vy += fy2 * mobility_j;
-                        }
-                    }
+        }
+
+        // Pairs with forward neighbor cells
+        GridCell* neighbors[4] = {
+            grid_get_cell(gx + 1, gy),
+            grid_get_cell(gx - 1, gy + 1),
+            grid_get_cell(gx, gy + 1),
+            grid_get_cell(gx + 1, gy + 1)
+        };
+
+        for (int n = 0; n < 4; n++) {
+            GridCell* other = neighbors[n];
+            if (!other || other->count == 0) continue;
+
+            for (int a = 0; a < cell->count; a++) {
+                for (int b = 0; b < other->count; b++) {
+                    resolve_cross_cell_pair(nodes, mobility, repulsion,
+                                            node_count,
+                                            cell->node_indices[a],
+                                            other->node_indices[b]);
                 }
             }
         }
     }
 }
 
+static void apply_repulsion_forces(void) {
+    int grid_height = grid_get_height();
+    int thread_count = worker_pool_get_thread_count();
+
+    // Stripes must be at least 2 rows tall so that non-adjacent stripes
+    // can never touch the same nodes (neighbor reach is 1 row)
+    int stripe_height = grid_height / (thread_count * 4);
+    if (stripe_height < 2) stripe_height = 2;
+    g_repulsion_stripe_height = stripe_height;
+
+    int stripe_count = (grid_height + stripe_height - 1) / stripe_height;
+    int even_stripes = (stripe_count + 1) / 2;
+    int odd_stripes = stripe_count / 2;
+
+    g_repulsion_stripe_parity = 0;
+    worker_pool_run(repulsion_stripe_task, NULL, even_stripes);
+
+    g_repulsion_stripe_parity = 1;
+    worker_pool_run(repulsion_stripe_task, NULL, odd_stripes);
+}
+
 static void apply_chain_forces(void) {
     Chain* chains = simulation_get_chains();
     Node* nodes = simulation_get_nodes();
+    const float* mobility = simulation_get_node_mobility();
     int chain_count = simulation_get_chain_count();
     int node_count = simulation_get_node_count();
     
@@ -146,80 +198,79 @@ static void apply_chain_forces(void) {
             float fx = dx * force_magnitude;
             float fy = dy * force_magnitude;
             
-            // Apply mobility factor for chain forces (only for plants)
-            PlantType* pt_n1 = plants_get_type(nodes[n1].plant_type);
-            PlantType* pt_n2 = plants_get_type(nodes[n2].plant_type);
-            
-            float mobility_n1 = pt_n1 ? pt_n1->mobility_factor : 1.0f;
-            float mobility_n2 = pt_n2 ? pt_n2->mobility_factor : 1.0f;
-            
-            nodes[n1].vx += fx * mobility_n1;
-            nodes[n1].vy += fy * mobility_n1;
-            nodes[n2].vx -= fx * mobility_n2;
-            nodes[n2].vy -= fy * mobility_n2;
+            // Apply cached mobility factor for chain forces
+            nodes[n1].vx += fx * mobility[n1];
+            nodes[n1].vy += fy * mobility[n1];
+            nodes[n2].vx -= fx * mobility[n2];
+            nodes[n2].vy -= fy * mobility[n2];
         }
     }
 }
 
 // Turn fish 180 degrees and face inward when hitting world bounds
 static void turn_fish_180_inward(int node_id) {
-    Fish* all_fish = fish_get_all();
-    int fish_count = fish_get_count();
-    
-    // Find the fish that owns this node
-    for (int i = 0; i < fish_count; i++) {
-        if (all_fish[i].active && all_fish[i].node_id == node_id) {
-            // Turn fish 180 degrees
-            all_fish[i].heading += M_PI;
-            
-            // Normalize heading to [0, 2π]
-            while (all_fish[i].heading >= 2.0f * M_PI) {
-                all_fish[i].heading -= 2.0f * M_PI;
-            }
-            while (all_fish[i].heading < 0.0f) {
-                all_fish[i].heading += 2.0f * M_PI;
-            }
-            
-            break;
-        }
+    Fish* fish = fish_get_by_node(node_id);
+    if (!fish) return;
+
+    // Turn fish 180 degrees
+    fish->heading += M_PI;
+
+    // Normalize heading to [0, 2π]
+    while (fish->heading >= 2.0f * M_PI) {
+        fish->heading -= 2.0f * M_PI;
+    }
+    while (fish->heading < 0.0f) {
+        fish->heading += 2.0f * M_PI;
     }
 }
 
 void physics_update(void) {
     simulation_update_frame_counter();
-    
-    // Rebuild spatial grid periodically for performance
-    if (simulation_get_frame_counter() % 5 == 0) {
-        grid_rebuild();
+
+    // Grid is maintained incrementally below; rebuild occasionally to
+    // compact the occupied-cell list and drop dead node references.
+    // When the node array is mostly holes, compact it instead (which
+    // rebuilds the grid itself).
+    if (simulation_get_frame_counter() % 300 == 0) {
+        profiler_stage_begin(PROF_STAGE_GRID);
+        if (!simulation_maybe_compact()) {
+            grid_rebuild();
+        }
+        profiler_stage_end(PROF_STAGE_GRID);
     }
-    
+
     // Apply forces
+    profiler_stage_begin(PROF_STAGE_REPULSION);
     apply_repulsion_forces();
+    profiler_stage_end(PROF_STAGE_REPULSION);
+    profiler_stage_begin(PROF_STAGE_CHAINS);
     apply_chain_forces();
-    
+    profiler_stage_end(PROF_STAGE_CHAINS);
+
     // Plant growth (includes gas heatmap update)
+    profiler_stage_begin(PROF_STAGE_PLANTS);
     plants_grow();
-    
-    // Update positions with drag and world bounds
+    profiler_stage_end(PROF_STAGE_PLANTS);
+
+    // Drag and integration run vectorized over the SoA hot arrays
+    profiler_stage_begin(PROF_STAGE_INTEGRATION);
+    simulation_gather_hot_arrays();
+    simulation_integrate_hot_arrays(WATER_DRAG);
+    simulation_scatter_hot_arrays();
+    profiler_stage_end(PROF_STAGE_INTEGRATION);
+
+    // Handle world bounds per node (ages are birth-frame arithmetic,
+    // so no aging pass is needed here)
+    profiler_stage_begin(PROF_STAGE_BOUNDS);
     Node* nodes = simulation_get_nodes();
-    Chain* chains = simulation_get_chains();
     int node_count = simulation_get_node_count();
-    int chain_count = simulation_get_chain_count();
-    
+
     for (int i = 0; i < node_count; i++) {
-        if (!nodes[i].active) continue;
-        
-        // Age nodes
-        nodes[i].age++;
-        
-        // Apply drag
-        nodes[i].vx *= WATER_DRAG;
-        nodes[i].vy *= WATER_DRAG;
-        
-        // Update position
-        nodes[i].x += nodes[i].vx;
-        nodes[i].y += nodes[i].vy;
-        
+        if (!nodes[i].active) {
+            grid_update_node(i);
+            continue;
+        }
+
         // Enhanced world bounds collision for fish - larger detection zone
         if (nodes[i].plant_type == -1) { // Fish node
             int collision_occurred = 0;
@@ -273,12 +324,9 @@ void physics_update(void) {
                 nodes[i].vy = 0;
             }
         }
+
+        // Move node between grid cells if it crossed a cell boundary
+        grid_update_node(i);
     }
-    
-    // Age chains
-    for (int i = 0; i < chain_count; i++) {
-        if (chains[i].active) {
-            chains[i].age++;
-        }
-    }
+    profiler_stage_end(PROF_STAGE_BOUNDS);
 }
\ No newline at end of file
@@ -9,7 +9,9 @@
 #include "grid.h"
 #include "nutrition.h"
 #include "gas.h"
+#include "profiler.h"
 #include "temperature.h"
+#include "lod.h"
 
 // Plant configuration storage
 static PlantType g_plant_types[MAX_PLANT_TYPES];
@@ -20,6 +22,13 @@ static float g_environmental_nutrition_balance = 0.0f;
 static float g_initial_environmental_nutrition = 0.0f;
 static int g_initial_nutrition_calculated = 0;
 
+// Growth candidate queue: node ids that can still grow. Nodes enter at
+// spawn and are dropped lazily once saturated, too old or removed, so
+// the growth stage skips the branch-saturated bulk of an old reef.
+static int* g_growth_candidates = NULL;
+static int g_growth_candidate_count = 0;
+static int g_growth_candidate_capacity = 0;
+
 // Parse hex color string to RGB values
 static void parse_color(const char* color_str, int* r, int* g, int* b) {
     const char* hex = color_str;
@@ -246,6 +255,43 @@ static float calculate_nutrition_growth_modifier(float nutrition_value) {
     }
 }
 
+// Check whether a node still belongs in the growth candidate queue
+static int is_growth_candidate(Node* node, int current_frame) {
+    if (!node->active || !node->can_grow) return 0;
+    if (node->plant_type < 0 || node->plant_type >= g_plant_type_count) return 0;
+
+    PlantType* pt = &g_plant_types[node->plant_type];
+    if (node->branch_count >= pt->max_branches) return 0;
+    if (current_frame - node->birth_frame > pt->age_mature) return 0;
+    return 1;
+}
+
+// Queue a freshly spawned plant node for growth consideration
+void plants_register_growth_candidate(int node_id) {
+    if (g_growth_candidate_count >= g_growth_candidate_capacity) {
+        int new_capacity = g_growth_candidate_capacity ? g_growth_candidate_capacity * 2 : 1024;
+        int* grown = realloc(g_growth_candidates, new_capacity * sizeof(int));
+        if (!grown) return;
+        g_growth_candidates = grown;
+        g_growth_candidate_capacity = new_capacity;
+    }
+    g_growth_candidates[g_growth_candidate_count++] = node_id;
+}
+
+// Rebuild the queue after node indices change (compaction, snapshot load)
+void plants_refresh_growth_candidates(void) {
+    Node* nodes = simulation_get_nodes();
+    int node_count = simulation_get_node_count();
+    int current_frame = simulation_get_frame_counter();
+
+    g_growth_candidate_count = 0;
+    for (int i = 0; i < node_count; i++) {
+        if (is_growth_candidate(&nodes[i], current_frame)) {
+            plants_register_growth_candidate(i);
+        }
+    }
+}
+
 // Main plant growth simulation
 void plants_grow(void) {
     // Initialize nutrition tracking on first call
@@ -253,38 +299,50 @@ void plants_grow(void) {
     
     Node* nodes = simulation_get_nodes();
     int current_node_count = simulation_get_node_count();
-    
+    int current_frame = simulation_get_frame_counter();
+
     // Update environmental systems
     nutrition_regenerate();
+    profiler_stage_begin(PROF_STAGE_GAS);
     gas_update_heatmap();
+    profiler_stage_end(PROF_STAGE_GAS);
     
     // Limit growth per frame for performance
     int growth_limit = (current_node_count / 100) + 3;
     if (growth_limit > 50) growth_limit = 50;
     
     int grown = 0;
-    
-    for (int i = 0; i < current_node_count && grown < growth_limit; i++) {
-        if (!nodes[i].active || !nodes[i].can_grow) continue;
-        
+
+    // Walk only the candidate queue; nodes that saturated, aged out or
+    // died since their last visit are swap-removed in place
+    int idx = 0;
+    while (idx < g_growth_candidate_count && grown < growth_limit) {
+        int i = g_growth_candidates[idx];
+
+        if (i < 0 || i >= current_node_count || !is_growth_candidate(&nodes[i], current_frame)) {
+            g_growth_candidates[idx] = g_growth_candidates[--g_growth_candidate_count];
+            continue;
+        }
+        idx++;
+
         int plant_type = nodes[i].plant_type;
-        if (plant_type < 0 || plant_type >= g_plant_type_count) continue;
-        
         PlantType* pt = &g_plant_types[plant_type];
-        
-        // Check growth constraints
-        if (nodes[i].branch_count >= pt->max_branches) continue;
-        if (nodes[i].age > pt->age_mature) continue;
-        
-        // Skip bleached corals (cannot grow when stressed)
+
+        // Skip bleached corals (cannot grow when stressed, but they can
+        // recover, so they stay queued)
         if (temperature_is_coral_bleached(i)) {
             continue;
         }
-        
+
+        // LOD: dormant regions sleep most frames, then roll the banked
+        // frames' worth of growth probability in one go
+        int lod_steps = lod_region_steps(nodes[i].x, nodes[i].y);
+        if (lod_steps == 0) continue;
+
         // Calculate growth probability based on local nutrition
         float nutrition_value = nutrition_get_value_at(nodes[i].x, nodes[i].y);
         float nutrition_modifier = calculate_nutrition_growth_modifier(nutrition_value);
-        float modified_growth_prob = pt->growth_probability * nutrition_modifier;
+        float modified_growth_prob = pt->growth_probability * nutrition_modifier * lod_steps;
         
         // Roll for growth
         if ((float)rand() / RAND_MAX < modified_growth_prob) {
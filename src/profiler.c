@@ -0,0 +1,113 @@
+// For clock_gettime under -std=c99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "profiler.h"
+
+// Rolling window size: 4 seconds of history at the 30 FPS target
+#define PROFILER_WINDOW 120
+
+// Per-frame accumulators and rolling history (milliseconds)
+static double g_stage_start[PROF_STAGE_COUNT];
+static double g_frame_accum[PROF_STAGE_COUNT];
+static float g_window[PROF_STAGE_COUNT][PROFILER_WINDOW];
+static float g_last_ms[PROF_STAGE_COUNT];
+static int g_window_head = 0;
+static int g_window_filled = 0;
+
+static const char* g_stage_names[PROF_STAGE_COUNT] = {
+    "grid rebuild",
+    "repulsion",
+    "chains",
+    "plants_grow",
+    "gas heatmap",
+    "integration",
+    "bounds/aging",
+    "fish vision",
+    "fish_update",
+    "brain inference",
+    "python bridge",
+    "temperature",
+    "render"
+};
+
+// Monotonic wall clock in seconds
+static double now_seconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+void profiler_stage_begin(ProfStage stage) {
+    g_stage_start[stage] = now_seconds();
+}
+
+void profiler_stage_end(ProfStage stage) {
+    g_frame_accum[stage] += now_seconds() - g_stage_start[stage];
+}
+
+void profiler_frame_end(void) {
+    for (int i = 0; i < PROF_STAGE_COUNT; i++) {
+        float ms = (float)(g_frame_accum[i] * 1000.0);
+        g_last_ms[i] = ms;
+        g_window[i][g_window_head] = ms;
+        g_frame_accum[i] = 0.0;
+    }
+
+    g_window_head++;
+    if (g_window_head >= PROFILER_WINDOW) {
+        g_window_head = 0;
+        g_window_filled = 1;
+    }
+}
+
+float profiler_get_last_ms(ProfStage stage) {
+    if (stage < 0 || stage >= PROF_STAGE_COUNT) return 0.0f;
+    return g_last_ms[stage];
+}
+
+// Percentile over the rolling window via insertion sort on a local
+// copy; only called from the once-per-second stats export path
+float profiler_get_percentile_ms(ProfStage stage, float percentile) {
+    if (stage < 0 || stage >= PROF_STAGE_COUNT) return 0.0f;
+
+    int count = g_window_filled ? PROFILER_WINDOW : g_window_head;
+    if (count == 0) return 0.0f;
+
+    float sorted[PROFILER_WINDOW];
+    memcpy(sorted, g_window[stage], count * sizeof(float));
+
+    for (int i = 1; i < count; i++) {
+        float value = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > value) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = value;
+    }
+
+    if (percentile < 0.0f) percentile = 0.0f;
+    if (percentile > 100.0f) percentile = 100.0f;
+    int index = (int)(percentile / 100.0f * (float)(count - 1) + 0.5f);
+    return sorted[index];
+}
+
+const char* profiler_get_stage_name(ProfStage stage) {
+    if (stage < 0 || stage >= PROF_STAGE_COUNT) return "unknown";
+    return g_stage_names[stage];
+}
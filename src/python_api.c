@@ -4,14 +4,23 @@
 #include "types.h"
 #include "python_api.h"
 #include "fish.h"
+#include "fish_brain.h"
 #include "simulation.h"
 #include "nutrition.h"
 #include "temperature.h"
 #include "plants.h"
+#include "profiler.h"
 
 static PyObject* g_python_module = NULL;
 static PyObject* g_update_function = NULL;
 
+// Batched RL staging buffers shared with Python as writable memoryviews.
+// One sync/commit call per frame replaces per-fish boundary crossings.
+static float* g_batch_inputs = NULL;    // MAX_FISH x RL_INPUT_SIZE
+static float* g_batch_outputs = NULL;   // MAX_FISH x RL_OUTPUT_SIZE
+static float* g_batch_rewards = NULL;   // MAX_FISH
+static unsigned char* g_batch_active = NULL;  // MAX_FISH
+
 // Temperature control functions
 static PyObject* py_temperature_get_current(PyObject* self, PyObject* args) {
     (void)self;
@@ -229,6 +238,142 @@ static PyObject* py_fish_set_rl_outputs(PyObject* self, PyObject* args) {
     Py_RETURN_NONE;
 }
 
+// Copy a Python float sequence into a fixed-size float array
+static int copy_float_sequence(PyObject* seq, float* dest, int expected) {
+    PyObject* fast = PySequence_Fast(seq, "expected a sequence of floats");
+    if (!fast) return 0;
+
+    if (PySequence_Fast_GET_SIZE(fast) != expected) {
+        Py_DECREF(fast);
+        PyErr_Format(PyExc_ValueError, "expected %d floats", expected);
+        return 0;
+    }
+
+    for (int i = 0; i < expected; i++) {
+        dest[i] = (float)PyFloat_AsDouble(PySequence_Fast_GET_ITEM(fast, i));
+    }
+
+    Py_DECREF(fast);
+    return !PyErr_Occurred();
+}
+
+// Push network weights into the native inference engine
+static PyObject* py_fish_brain_set_weights(PyObject* self, PyObject* args) {
+    (void)self;
+    int fish_id;
+    float exploration_rate;
+    PyObject *w1_obj, *b1_obj, *w2_obj, *b2_obj;
+
+    if (!PyArg_ParseTuple(args, "iOOOOf", &fish_id, &w1_obj, &b1_obj,
+                          &w2_obj, &b2_obj, &exploration_rate)) {
+        return NULL;
+    }
+
+    float w1[RL_INPUT_SIZE * FISH_BRAIN_HIDDEN_SIZE];
+    float b1[FISH_BRAIN_HIDDEN_SIZE];
+    float w2[FISH_BRAIN_HIDDEN_SIZE * RL_OUTPUT_SIZE];
+    float b2[RL_OUTPUT_SIZE];
+
+    if (!copy_float_sequence(w1_obj, w1, RL_INPUT_SIZE * FISH_BRAIN_HIDDEN_SIZE)) return NULL;
+    if (!copy_float_sequence(b1_obj, b1, FISH_BRAIN_HIDDEN_SIZE)) return NULL;
+    if (!copy_float_sequence(w2_obj, w2, FISH_BRAIN_HIDDEN_SIZE * RL_OUTPUT_SIZE)) return NULL;
+    if (!copy_float_sequence(b2_obj, b2, RL_OUTPUT_SIZE)) return NULL;
+
+    fish_brain_set_weights(fish_id, w1, b1, w2, b2, exploration_rate);
+    Py_RETURN_NONE;
+}
+
+static PyObject* py_fish_brain_clear(PyObject* self, PyObject* args) {
+    (void)self;
+    int fish_id;
+
+    if (!PyArg_ParseTuple(args, "i", &fish_id)) {
+        return NULL;
+    }
+
+    fish_brain_clear(fish_id);
+    Py_RETURN_NONE;
+}
+
+// Batched RL bridge: expose the staging matrices as writable memoryviews
+// (call once from Python; cast to 'f' on that side for float indexing)
+static PyObject* py_fish_get_rl_batch_views(PyObject* self, PyObject* args) {
+    (void)self;
+    (void)args;
+
+    if (!g_batch_inputs) {
+        PyErr_SetString(PyExc_RuntimeError, "RL batch buffers not allocated");
+        return NULL;
+    }
+
+    PyObject* inputs_view = PyMemoryView_FromMemory((char*)g_batch_inputs,
+        (Py_ssize_t)MAX_FISH * RL_INPUT_SIZE * sizeof(float), PyBUF_WRITE);
+    PyObject* outputs_view = PyMemoryView_FromMemory((char*)g_batch_outputs,
+        (Py_ssize_t)MAX_FISH * RL_OUTPUT_SIZE * sizeof(float), PyBUF_WRITE);
+    PyObject* rewards_view = PyMemoryView_FromMemory((char*)g_batch_rewards,
+        (Py_ssize_t)MAX_FISH * sizeof(float), PyBUF_WRITE);
+    PyObject* active_view = PyMemoryView_FromMemory((char*)g_batch_active,
+        (Py_ssize_t)MAX_FISH * sizeof(unsigned char), PyBUF_WRITE);
+
+    if (!inputs_view || !outputs_view || !rewards_view || !active_view) {
+        Py_XDECREF(inputs_view);
+        Py_XDECREF(outputs_view);
+        Py_XDECREF(rewards_view);
+        Py_XDECREF(active_view);
+        return NULL;
+    }
+
+    return Py_BuildValue("(NNNN)", inputs_view, outputs_view, rewards_view, active_view);
+}
+
+// Gather inputs, rewards and active flags for all fish into the staging
+// buffers; returns the number of fish slots to process. Slots are
+// sparse, so the bound is the highest used slot, not the active count.
+static PyObject* py_fish_sync_rl_batch(PyObject* self, PyObject* args) {
+    (void)self;
+    (void)args;
+
+    Fish* all_fish = fish_get_all();
+    int slot_count = fish_get_highest_slot() + 1;
+
+    for (int i = 0; i < slot_count; i++) {
+        if (!all_fish[i].active) {
+            g_batch_active[i] = 0;
+            continue;
+        }
+
+        g_batch_active[i] = 1;
+        for (int k = 0; k < RL_INPUT_SIZE; k++) {
+            g_batch_inputs[i * RL_INPUT_SIZE + k] = all_fish[i].rl_inputs[k];
+        }
+        for (int k = 0; k < RL_OUTPUT_SIZE; k++) {
+            g_batch_outputs[i * RL_OUTPUT_SIZE + k] = all_fish[i].rl_outputs[k];
+        }
+        g_batch_rewards[i] = fish_get_last_reward(i);
+    }
+
+    return PyLong_FromLong(slot_count);
+}
+
+// Scatter the output matrix written by Python back to the fish array
+static PyObject* py_fish_commit_rl_outputs(PyObject* self, PyObject* args) {
+    (void)self;
+    (void)args;
+
+    Fish* all_fish = fish_get_all();
+    int slot_count = fish_get_highest_slot() + 1;
+
+    for (int i = 0; i < slot_count; i++) {
+        if (!all_fish[i].active) continue;
+
+        for (int k = 0; k < RL_OUTPUT_SIZE; k++) {
+            all_fish[i].rl_outputs[k] = g_batch_outputs[i * RL_OUTPUT_SIZE + k];
+        }
+    }
+
+    Py_RETURN_NONE;
+}
+
 static PyObject* py_fish_get_last_reward(PyObject* self, PyObject* args) {
     (void)self;
     int fish_id;
@@ -367,6 +512,34 @@ static PyObject* py_get_rl_info(PyObject* self, PyObject* args) {
     return Py_BuildValue("(ii)", RL_INPUT_SIZE, RL_OUTPUT_SIZE);
 }
 
+// Frame profiler access for live stage-timing charts
+static PyObject* py_get_profiler_stage_count(PyObject* self, PyObject* args) {
+    (void)self;
+    (void)args;
+    return PyLong_FromLong(PROF_STAGE_COUNT);
+}
+
+static PyObject* py_get_profiler_stage_info(PyObject* self, PyObject* args) {
+    (void)self;
+
+    int stage;
+    if (!PyArg_ParseTuple(args, "i", &stage)) {
+        return NULL;
+    }
+
+    if (stage < 0 || stage >= PROF_STAGE_COUNT) {
+        PyErr_SetString(PyExc_IndexError, "Invalid profiler stage index");
+        return NULL;
+    }
+
+    // (name, last frame ms, p50 ms, p95 ms) over the rolling window
+    return Py_BuildValue("(sfff)",
+                         profiler_get_stage_name(stage),
+                         profiler_get_last_ms(stage),
+                         profiler_get_percentile_ms(stage, 50.0f),
+                         profiler_get_percentile_ms(stage, 95.0f));
+}
+
 // Legacy compatibility functions for older scripts
 static PyObject* py_fish_get_energy(PyObject* self, PyObject* args) {
     (void)self;
@@ -495,6 +668,15 @@ static PyMethodDef SimulationMethods[] = {
     {"fish_get_rl_inputs", py_fish_get_rl_inputs, METH_VARARGS, "Get RL inputs (7 inputs)"},
     {"fish_set_rl_outputs", py_fish_set_rl_outputs, METH_VARARGS, "Set RL outputs (3 outputs)"},
     {"fish_get_last_reward", py_fish_get_last_reward, METH_VARARGS, "Get fish last reward"},
+
+    // Native inference engine weight management
+    {"fish_brain_set_weights", py_fish_brain_set_weights, METH_VARARGS, "Push network weights to the native inference engine"},
+    {"fish_brain_clear", py_fish_brain_clear, METH_VARARGS, "Drop native weights for a fish slot"},
+
+    // Batched RL bridge (one sync/commit per frame, zero-copy views)
+    {"fish_get_rl_batch_views", py_fish_get_rl_batch_views, METH_NOARGS, "Get (inputs, outputs, rewards, active) memoryviews"},
+    {"fish_sync_rl_batch", py_fish_sync_rl_batch, METH_NOARGS, "Gather RL inputs/rewards/active into batch buffers"},
+    {"fish_commit_rl_outputs", py_fish_commit_rl_outputs, METH_NOARGS, "Apply batch output matrix to all fish"},
     {"fish_get_stomach_contents", py_fish_get_stomach_contents, METH_VARARGS, "Get fish stomach contents"},
     {"fish_is_eating", py_fish_is_eating, METH_VARARGS, "Check if fish is in eating mode"},
     {"fish_get_type_count", py_fish_get_type_count, METH_NOARGS, "Get fish type count"},
@@ -521,6 +703,8 @@ static PyMethodDef SimulationMethods[] = {
     {"get_world_bounds", py_get_world_bounds, METH_NOARGS, "Get world boundaries"},
     {"get_nutrition_balance", py_get_nutrition_balance, METH_NOARGS, "Get nutrition cycle balance"},
     {"get_rl_info", py_get_rl_info, METH_NOARGS, "Get RL system info (7 inputs, 3 outputs)"},
+    {"get_profiler_stage_count", py_get_profiler_stage_count, METH_NOARGS, "Get number of profiler stages"},
+    {"get_profiler_stage_info", py_get_profiler_stage_info, METH_VARARGS, "Get (name, last_ms, p50_ms, p95_ms) for a profiler stage"},
     
     // Legacy compatibility functions
     {"fish_get_energy", py_fish_get_energy, METH_VARARGS, "Get fish energy (legacy)"},
@@ -568,7 +752,18 @@ int python_api_init(void) {
         printf("Failed to initialize Python interpreter\n");
         return 0;
     }
-    
+
+    // Allocate RL batch staging buffers
+    g_batch_inputs = (float*)calloc((size_t)MAX_FISH * RL_INPUT_SIZE, sizeof(float));
+    g_batch_outputs = (float*)calloc((size_t)MAX_FISH * RL_OUTPUT_SIZE, sizeof(float));
+    g_batch_rewards = (float*)calloc(MAX_FISH, sizeof(float));
+    g_batch_active = (unsigned char*)calloc(MAX_FISH, sizeof(unsigned char));
+
+    if (!g_batch_inputs || !g_batch_outputs || !g_batch_rewards || !g_batch_active) {
+        printf("Failed to allocate RL batch buffers\n");
+        return 0;
+    }
+
     printf("Python API initialized with neural network support\n");
     return 1;
 }
@@ -587,6 +782,11 @@ void python_api_cleanup(void) {
     if (Py_IsInitialized()) {
         Py_Finalize();
     }
+
+    if (g_batch_inputs) { free(g_batch_inputs); g_batch_inputs = NULL; }
+    if (g_batch_outputs) { free(g_batch_outputs); g_batch_outputs = NULL; }
+    if (g_batch_rewards) { free(g_batch_rewards); g_batch_rewards = NULL; }
+    if (g_batch_active) { free(g_batch_active); g_batch_active = NULL; }
 }
 
 int python_api_run_script(const char* script_path) {
@@ -621,6 +821,28 @@ int python_api_run_script(const char* script_path) {
     return 1;
 }
 
+// Ask the controller script to persist its best models. Farm workers
+// terminate on a frame budget instead of a signal, so Python's own
+// signal handler never fires for them.
+void python_api_request_model_save(void) {
+    if (!g_python_module) return;
+
+    PyObject* save_function = PyObject_GetAttrString(g_python_module, "save_best_models");
+    if (!save_function || !PyCallable_Check(save_function)) {
+        if (save_function) Py_DECREF(save_function);
+        PyErr_Clear();
+        return;
+    }
+
+    PyObject* result = PyObject_CallObject(save_function, NULL);
+    if (result) {
+        Py_DECREF(result);
+    } else if (PyErr_Occurred()) {
+        PyErr_Print();
+    }
+    Py_DECREF(save_function);
+}
+
 void python_api_update(void) {
     if (!g_update_function) return;
     
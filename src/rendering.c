@@ -1,11 +1,13 @@
 #include <SDL2/SDL.h>
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "types.h"
 #include "rendering.h"
 #include "simulation.h"
+#include "grid.h"
 #include "camera.h"
 #include "plants.h"
 #include "fish.h"
@@ -22,22 +24,259 @@ static char g_fps_text[32] = "FPS: 0.0";
 
 // Forward declarations
 static void draw_thick_line(SDL_Renderer* renderer, int x1, int y1, int x2, int y2, int thickness);
-static void draw_curved_line(SDL_Renderer* renderer, int x1, int y1, int x2, int y2, float curve_strength, float curve_offset, int thickness);
-static void draw_enhanced_fish_tail(SDL_Renderer* renderer, int screen_x, int screen_y, float heading, FishType* fish_type, float base_radius, int r, int g, int b);
 static void draw_fish_rl_vision(SDL_Renderer* renderer, int fish_id);
 static void render_flow_based_water_background(void);
 
-// Find fish by node ID for rendering
+// Find fish by node ID for rendering (O(1) via the reverse index)
 static Fish* find_fish_by_node_id(int node_id) {
-    Fish* all_fish = fish_get_all();
-    int highest_slot = fish_get_highest_slot();
-    
-    for (int i = 0; i <= highest_slot && i < MAX_FISH; i++) {
-        if (all_fish[i].active && all_fish[i].node_id == node_id) {
-            return &all_fish[i];
+    return fish_get_by_node(node_id);
+}
+
+// Geometry batch: visible primitives are tessellated into one vertex/
+// index array per frame and submitted with a single SDL_RenderGeometry
+// call instead of per-pixel software fills
+static SDL_Vertex* g_batch_vertices = NULL;
+static int* g_batch_indices = NULL;
+static int g_batch_vertex_count = 0;
+static int g_batch_index_count = 0;
+static int g_batch_vertex_capacity = 0;
+static int g_batch_index_capacity = 0;
+
+// Visible node set rebuilt each frame from the spatial grid
+static int* g_visible_nodes = NULL;
+static int g_visible_count = 0;
+static int g_visible_capacity = 0;
+static unsigned char* g_node_visible = NULL;
+static int g_node_visible_capacity = 0;
+
+static int batch_reserve(int extra_vertices, int extra_indices) {
+    if (g_batch_vertex_count + extra_vertices > g_batch_vertex_capacity) {
+        int new_capacity = g_batch_vertex_capacity > 0 ? g_batch_vertex_capacity * 2 : 4096;
+        while (new_capacity < g_batch_vertex_count + extra_vertices) new_capacity *= 2;
+        SDL_Vertex* grown = (SDL_Vertex*)realloc(g_batch_vertices, new_capacity * sizeof(SDL_Vertex));
+        if (!grown) return 0;
+        g_batch_vertices = grown;
+        g_batch_vertex_capacity = new_capacity;
+    }
+    if (g_batch_index_count + extra_indices > g_batch_index_capacity) {
+        int new_capacity = g_batch_index_capacity > 0 ? g_batch_index_capacity * 2 : 8192;
+        while (new_capacity < g_batch_index_count + extra_indices) new_capacity *= 2;
+        int* grown = (int*)realloc(g_batch_indices, new_capacity * sizeof(int));
+        if (!grown) return 0;
+        g_batch_indices = grown;
+        g_batch_index_capacity = new_capacity;
+    }
+    return 1;
+}
+
+static void batch_add_vertex(float x, float y, SDL_Color color) {
+    SDL_Vertex* v = &g_batch_vertices[g_batch_vertex_count++];
+    v->position.x = x;
+    v->position.y = y;
+    v->color = color;
+    v->tex_coord.x = 0.0f;
+    v->tex_coord.y = 0.0f;
+}
+
+static void batch_push_triangle(float x1, float y1, float x2, float y2,
+                                float x3, float y3, SDL_Color color) {
+    if (!batch_reserve(3, 3)) return;
+    int base = g_batch_vertex_count;
+    batch_add_vertex(x1, y1, color);
+    batch_add_vertex(x2, y2, color);
+    batch_add_vertex(x3, y3, color);
+    g_batch_indices[g_batch_index_count++] = base;
+    g_batch_indices[g_batch_index_count++] = base + 1;
+    g_batch_indices[g_batch_index_count++] = base + 2;
+}
+
+// Thick line segment as a quad (two triangles)
+static void batch_push_line(float x1, float y1, float x2, float y2,
+                            float thickness, SDL_Color color) {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length < 0.001f) return;
+
+    float half = thickness * 0.5f;
+    if (half < 0.5f) half = 0.5f;
+    float perp_x = (-dy / length) * half;
+    float perp_y = (dx / length) * half;
+
+    if (!batch_reserve(4, 6)) return;
+    int base = g_batch_vertex_count;
+    batch_add_vertex(x1 + perp_x, y1 + perp_y, color);
+    batch_add_vertex(x1 - perp_x, y1 - perp_y, color);
+    batch_add_vertex(x2 - perp_x, y2 - perp_y, color);
+    batch_add_vertex(x2 + perp_x, y2 + perp_y, color);
+    g_batch_indices[g_batch_index_count++] = base;
+    g_batch_indices[g_batch_index_count++] = base + 1;
+    g_batch_indices[g_batch_index_count++] = base + 2;
+    g_batch_indices[g_batch_index_count++] = base;
+    g_batch_indices[g_batch_index_count++] = base + 2;
+    g_batch_indices[g_batch_index_count++] = base + 3;
+}
+
+// Filled circle as a triangle fan with radius-dependent tessellation
+static void batch_push_circle(float cx, float cy, float radius, SDL_Color color) {
+    if (radius < 0.5f) radius = 0.5f;
+
+    int segments = (int)(radius * 2.0f) + 6;
+    if (segments > 24) segments = 24;
+
+    if (!batch_reserve(segments + 1, segments * 3)) return;
+    int center = g_batch_vertex_count;
+    batch_add_vertex(cx, cy, color);
+
+    for (int s = 0; s < segments; s++) {
+        float angle = (float)s / segments * 2.0f * (float)M_PI;
+        batch_add_vertex(cx + cosf(angle) * radius, cy + sinf(angle) * radius, color);
+    }
+    for (int s = 0; s < segments; s++) {
+        g_batch_indices[g_batch_index_count++] = center;
+        g_batch_indices[g_batch_index_count++] = center + 1 + s;
+        g_batch_indices[g_batch_index_count++] = center + 1 + ((s + 1) % segments);
+    }
+}
+
+// Curved plant chain as quad strips along a quadratic Bezier
+static void batch_push_curved_line(float x1, float y1, float x2, float y2,
+                                   float curve_strength, float curve_offset,
+                                   float thickness, SDL_Color color) {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float length = sqrtf(dx * dx + dy * dy);
+
+    if (length < 1.0f) {
+        batch_push_line(x1, y1, x2, y2, thickness, color);
+        return;
+    }
+
+    float mid_x = (x1 + x2) * 0.5f;
+    float mid_y = (y1 + y2) * 0.5f;
+    float perp_x = -dy / length;
+    float perp_y = dx / length;
+
+    float curve_amount = curve_strength * length * 0.3f + curve_offset;
+    float ctrl_x = mid_x + perp_x * curve_amount;
+    float ctrl_y = mid_y + perp_y * curve_amount;
+
+    int segments = (int)(length / 8.0f) + 3;
+    if (segments > 20) segments = 20;
+
+    float prev_x = x1;
+    float prev_y = y1;
+
+    for (int i = 1; i <= segments; i++) {
+        float t = (float)i / segments;
+        float inv_t = 1.0f - t;
+
+        // Quadratic Bezier curve
+        float curr_x = inv_t * inv_t * x1 + 2 * inv_t * t * ctrl_x + t * t * x2;
+        float curr_y = inv_t * inv_t * y1 + 2 * inv_t * t * ctrl_y + t * t * y2;
+
+        batch_push_line(prev_x, prev_y, curr_x, curr_y, thickness, color);
+
+        prev_x = curr_x;
+        prev_y = curr_y;
+    }
+}
+
+// Fish tail kite (base point, two corners, tip) as two triangles,
+// mirroring the shape draw_enhanced_fish_tail fills pixel by pixel
+static void batch_push_fish_tail(float screen_x, float screen_y, float heading,
+                                 FishType* fish_type, float base_radius, SDL_Color color) {
+    if (!fish_type) return;
+
+    float tail_length = base_radius * 2.5f * fish_type->tail_length_factor;
+    float tail_width = base_radius * 3.0f * fish_type->tail_width_factor;
+
+    // Tail sits opposite the heading direction
+    float tail_offset_distance = base_radius * 3.0f;
+    float tail_base_x = screen_x - cosf(heading) * tail_offset_distance;
+    float tail_base_y = screen_y - sinf(heading) * tail_offset_distance;
+
+    // Perpendicular vector for triangle width
+    float perp_x = -sinf(heading);
+    float perp_y = cosf(heading);
+
+    float corner1_x = tail_base_x + perp_x * tail_width * 0.5f;
+    float corner1_y = tail_base_y + perp_y * tail_width * 0.5f;
+    float corner2_x = tail_base_x - perp_x * tail_width * 0.5f;
+    float corner2_y = tail_base_y - perp_y * tail_width * 0.5f;
+    float tip_x = tail_base_x + cosf(heading) * tail_length;
+    float tip_y = tail_base_y + sinf(heading) * tail_length;
+
+    batch_push_triangle(tail_base_x, tail_base_y, corner1_x, corner1_y, tip_x, tip_y, color);
+    batch_push_triangle(tail_base_x, tail_base_y, tip_x, tip_y, corner2_x, corner2_y, color);
+}
+
+// Submit the accumulated batch in a single draw call
+static void batch_flush(void) {
+    if (g_batch_index_count > 0) {
+        SDL_RenderGeometry(g_renderer, NULL, g_batch_vertices, g_batch_vertex_count,
+                           g_batch_indices, g_batch_index_count);
+    }
+    g_batch_vertex_count = 0;
+    g_batch_index_count = 0;
+}
+
+// Collect nodes inside the viewport (plus one cell of margin for tails
+// and node radii) by walking only the grid cells the camera can see
+static void collect_visible_nodes(float world_left, float world_top,
+                                  float world_right, float world_bottom) {
+    // Unmark last frame's visible set
+    for (int i = 0; i < g_visible_count; i++) {
+        if (g_visible_nodes[i] < g_node_visible_capacity) {
+            g_node_visible[g_visible_nodes[i]] = 0;
+        }
+    }
+    g_visible_count = 0;
+
+    int node_count = simulation_get_node_count();
+    if (node_count > g_node_visible_capacity) {
+        int new_capacity = g_node_visible_capacity > 0 ? g_node_visible_capacity * 2 : 65536;
+        while (new_capacity < node_count) new_capacity *= 2;
+        unsigned char* grown = (unsigned char*)realloc(g_node_visible, new_capacity);
+        if (!grown) return;
+        memset(grown + g_node_visible_capacity, 0, new_capacity - g_node_visible_capacity);
+        g_node_visible = grown;
+        g_node_visible_capacity = new_capacity;
+    }
+
+    int min_gx, min_gy, max_gx, max_gy;
+    grid_world_to_grid_coords(world_left - GRID_SIZE, world_top - GRID_SIZE, &min_gx, &min_gy);
+    grid_world_to_grid_coords(world_right + GRID_SIZE, world_bottom + GRID_SIZE, &max_gx, &max_gy);
+
+    if (min_gx < 0) min_gx = 0;
+    if (min_gy < 0) min_gy = 0;
+    if (max_gx >= grid_get_width()) max_gx = grid_get_width() - 1;
+    if (max_gy >= grid_get_height()) max_gy = grid_get_height() - 1;
+
+    Node* nodes = simulation_get_nodes();
+
+    for (int gy = min_gy; gy <= max_gy; gy++) {
+        for (int gx = min_gx; gx <= max_gx; gx++) {
+            GridCell* cell = grid_get_cell(gx, gy);
+            if (!cell) continue;
+
+            for (int k = 0; k < cell->count; k++) {
+                int node_id = cell->node_indices[k];
+                if (node_id < 0 || node_id >= node_count) continue;
+                if (!nodes[node_id].active) continue;
+
+                if (g_visible_count >= g_visible_capacity) {
+                    int new_capacity = g_visible_capacity > 0 ? g_visible_capacity * 2 : 4096;
+                    int* grown = (int*)realloc(g_visible_nodes, new_capacity * sizeof(int));
+                    if (!grown) return;
+                    g_visible_nodes = grown;
+                    g_visible_capacity = new_capacity;
+                }
+                g_visible_nodes[g_visible_count++] = node_id;
+                g_node_visible[node_id] = 1;
+            }
         }
     }
-    return NULL;
 }
 
 // Simple bitmap font for FPS display
@@ -357,57 +596,6 @@ static void draw_thick_line(SDL_Renderer* renderer, int x1, int y1, int x2, int
     }
 }
 
-// Enhanced fish tail rendering with configurable size
-static void draw_enhanced_fish_tail(SDL_Renderer* renderer, int screen_x, int screen_y, float heading, FishType* fish_type, float base_radius, int r, int g, int b) {
-    if (!fish_type) return;
-    
-    // Apply visual configuration factors
-    float tail_length = base_radius * 2.5f * fish_type->tail_length_factor;
-    float tail_width = base_radius * 3.0f * fish_type->tail_width_factor;
-    
-    // Calculate tail position (opposite to heading direction)
-    float tail_offset_distance = base_radius * 3.0f;
-    int tail_base_x = screen_x - (int)(cos(heading) * tail_offset_distance);
-    int tail_base_y = screen_y - (int)(sin(heading) * tail_offset_distance);
-    
-    // Perpendicular vector for triangle width
-    float perp_x = -sin(heading);
-    float perp_y = cos(heading);
-    
-    // Calculate tail triangle points
-    int tail_corner1_x = tail_base_x + (int)(perp_x * tail_width * 0.5f);
-    int tail_corner1_y = tail_base_y + (int)(perp_y * tail_width * 0.5f);
-    int tail_corner2_x = tail_base_x - (int)(perp_x * tail_width * 0.5f);
-    int tail_corner2_y = tail_base_y - (int)(perp_y * tail_width * 0.5f);
-    int tail_tip_x = tail_base_x + (int)(cos(heading) * tail_length);
-    int tail_tip_y = tail_base_y + (int)(sin(heading) * tail_length);
-    
-    // Use same color as fish body
-    SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-    
-    // Draw tail triangle outline
-    SDL_RenderDrawLine(renderer, tail_base_x, tail_base_y, tail_corner1_x, tail_corner1_y);
-    SDL_RenderDrawLine(renderer, tail_corner1_x, tail_corner1_y, tail_tip_x, tail_tip_y);
-    SDL_RenderDrawLine(renderer, tail_tip_x, tail_tip_y, tail_corner2_x, tail_corner2_y);
-    SDL_RenderDrawLine(renderer, tail_corner2_x, tail_corner2_y, tail_base_x, tail_base_y);
-    
-    // Fill tail triangle for larger tails
-    if (tail_width > 2.0f) {
-        for (int i = 0; i <= (int)(tail_length); i++) {
-            float t = (float)i / tail_length;
-            
-            int edge_x1 = tail_corner1_x + (int)(t * (tail_tip_x - tail_corner1_x));
-            int edge_y1 = tail_corner1_y + (int)(t * (tail_tip_y - tail_corner1_y));
-            int edge_x2 = tail_corner2_x + (int)(t * (tail_tip_x - tail_corner2_x));
-            int edge_y2 = tail_corner2_y + (int)(t * (tail_tip_y - tail_corner2_y));
-            
-            SDL_RenderDrawLine(renderer, tail_base_x, tail_base_y, edge_x1, edge_y1);
-            SDL_RenderDrawLine(renderer, tail_base_x, tail_base_y, edge_x2, edge_y2);
-            SDL_RenderDrawLine(renderer, edge_x1, edge_y1, edge_x2, edge_y2);
-        }
-    }
-}
-
 // Draw fish RL vision rays for debugging
 static void draw_fish_rl_vision(SDL_Renderer* renderer, int fish_id) {
     if (!fish_is_ray_rendering_enabled()) return;
@@ -482,53 +670,6 @@ static void draw_fish_rl_vision(SDL_Renderer* renderer, int fish_id) {
     draw_thick_line(renderer, fish_screen_x, fish_screen_y, heading_end_x, heading_end_y, 3);
 }
 
-// Enhanced curved line drawing for plant chains
-static void draw_curved_line(SDL_Renderer* renderer, int x1, int y1, int x2, int y2, float curve_strength, float curve_offset, int thickness) {
-    float mid_x = (x1 + x2) * 0.5f;
-    float mid_y = (y1 + y2) * 0.5f;
-    
-    float dx = x2 - x1;
-    float dy = y2 - y1;
-    float length = sqrt(dx * dx + dy * dy);
-    
-    if (length < 1.0f) {
-        draw_thick_line(renderer, x1, y1, x2, y2, thickness);
-        return;
-    }
-    
-    dx /= length;
-    dy /= length;
-    
-    // Perpendicular vector for curve
-    float perp_x = -dy;
-    float perp_y = dx;
-    
-    float curve_amount = curve_strength * length * 0.3f + curve_offset;
-    float ctrl_x = mid_x + perp_x * curve_amount;
-    float ctrl_y = mid_y + perp_y * curve_amount;
-    
-    // Draw curved line using segments
-    int segments = (int)(length / 8.0f) + 3;
-    if (segments > 20) segments = 20;
-    
-    float prev_x = x1;
-    float prev_y = y1;
-    
-    for (int i = 1; i <= segments; i++) {
-        float t = (float)i / segments;
-        float inv_t = 1.0f - t;
-        
-        // Quadratic Bezier curve
-        float curr_x = inv_t * inv_t * x1 + 2 * inv_t * t * ctrl_x + t * t * x2;
-        float curr_y = inv_t * inv_t * y1 + 2 * inv_t * t * ctrl_y + t * t * y2;
-        
-        draw_thick_line(renderer, (int)prev_x, (int)prev_y, (int)curr_x, (int)curr_y, thickness);
-        
-        prev_x = curr_x;
-        prev_y = curr_y;
-    }
-}
-
 // FPS display functions
 void rendering_update_fps(float fps) {
     g_current_fps = fps;
@@ -563,6 +704,19 @@ int rendering_init(SDL_Renderer* renderer) {
 }
 
 void rendering_cleanup(void) {
+    free(g_batch_vertices);
+    g_batch_vertices = NULL;
+    free(g_batch_indices);
+    g_batch_indices = NULL;
+    g_batch_vertex_count = g_batch_index_count = 0;
+    g_batch_vertex_capacity = g_batch_index_capacity = 0;
+
+    free(g_visible_nodes);
+    g_visible_nodes = NULL;
+    free(g_node_visible);
+    g_node_visible = NULL;
+    g_visible_count = g_visible_capacity = g_node_visible_capacity = 0;
+
     g_renderer = NULL;
     printf("Rendering system cleaned up\n");
 }
@@ -582,75 +736,73 @@ void rendering_render(void) {
     // Get viewport bounds for culling
     float world_left, world_top, world_right, world_bottom;
     camera_get_viewport_bounds(&world_left, &world_top, &world_right, &world_bottom);
-    
+
+    // Build the visible node set from the spatial grid so render cost
+    // tracks what is on screen rather than total world population
+    collect_visible_nodes(world_left, world_top, world_right, world_bottom);
+
     Node* nodes = simulation_get_nodes();
     Chain* chains = simulation_get_chains();
     int node_count = simulation_get_node_count();
     int chain_count = simulation_get_chain_count();
     int selected_node = simulation_get_selected_node();
     int selection_mode = simulation_get_selection_mode();
-    
+
     // Render plant chains with enhanced visual properties
     for (int i = 0; i < chain_count; i++) {
         if (!chains[i].active) continue;
-        
+
         int n1 = chains[i].node1;
         int n2 = chains[i].node2;
-        
+
         if (n1 < 0 || n1 >= node_count || n2 < 0 || n2 >= node_count) continue;
+
+        // Chains span at most a few grid cells, so the visible node set
+        // (built with a cell of margin) covers every on-screen chain
+        if (!g_node_visible || (!g_node_visible[n1] && !g_node_visible[n2])) continue;
+
         if (!nodes[n1].active || !nodes[n2].active) continue;
-        
+
         // Skip chains involving fish nodes or corpses
         if (nodes[n1].plant_type == -1 || nodes[n2].plant_type == -1) continue;
         if (nodes[n1].is_corpse || nodes[n2].is_corpse) continue;
-        
-        // Frustum culling for performance
-        float min_x = fminf(nodes[n1].x, nodes[n2].x);
-        float max_x = fmaxf(nodes[n1].x, nodes[n2].x);
-        float min_y = fminf(nodes[n1].y, nodes[n2].y);
-        float max_y = fmaxf(nodes[n1].y, nodes[n2].y);
-        
-        if (max_x < world_left || min_x > world_right || 
-            max_y < world_top || min_y > world_bottom) {
-            continue;
-        }
-        
+
         // Get plant type for visual configuration
         int plant_type = chains[i].plant_type;
         PlantType* pt = plants_get_type(plant_type);
-        
+
         // Calculate chain color with aging and bleaching effects
+        SDL_Color chain_color = {100, 200, 100, 255};
         if (pt && pt->active) {
             int aged_r, aged_g, aged_b;
-            calculate_aged_color(pt->chain_r, pt->chain_g, pt->chain_b, chains[i].age, pt->age_mature, &aged_r, &aged_g, &aged_b);
-            
+            int chain_age = simulation_get_frame_counter() - chains[i].birth_frame;
+            calculate_aged_color(pt->chain_r, pt->chain_g, pt->chain_b, chain_age, pt->age_mature, &aged_r, &aged_g, &aged_b);
+
             // Check for coral bleaching
             if (temperature_is_coral_bleached(n1) || temperature_is_coral_bleached(n2)) {
                 int bleached_r, bleached_g, bleached_b;
                 calculate_bleached_color(aged_r, aged_g, aged_b, &bleached_r, &bleached_g, &bleached_b);
-                SDL_SetRenderDrawColor(g_renderer, bleached_r, bleached_g, bleached_b, 255);
+                chain_color.r = bleached_r; chain_color.g = bleached_g; chain_color.b = bleached_b;
             } else {
-                SDL_SetRenderDrawColor(g_renderer, aged_r, aged_g, aged_b, 255);
+                chain_color.r = aged_r; chain_color.g = aged_g; chain_color.b = aged_b;
             }
-        } else {
-            SDL_SetRenderDrawColor(g_renderer, 100, 200, 100, 255);
         }
-        
+
         // Convert world coordinates to screen coordinates
         int screen_x1, screen_y1, screen_x2, screen_y2;
         camera_world_to_screen(nodes[n1].x, nodes[n1].y, &screen_x1, &screen_y1);
         camera_world_to_screen(nodes[n2].x, nodes[n2].y, &screen_x2, &screen_y2);
-        
+
         // Calculate thickness with plant-specific factor
         float thickness_factor = pt ? pt->chain_thickness_factor : 1.0f;
-        int thickness = (int)(CHAIN_THICKNESS * camera_get_zoom() * thickness_factor);
-        if (thickness < 2) thickness = 2;
-        
+        float thickness = CHAIN_THICKNESS * camera_get_zoom() * thickness_factor;
+        if (thickness < 2.0f) thickness = 2.0f;
+
         // Apply curvature with plant-specific multiplier
         float final_curve_strength = chains[i].curve_strength * chains[i].curve_multiplier;
-        
-        draw_curved_line(g_renderer, screen_x1, screen_y1, screen_x2, screen_y2, 
-                        final_curve_strength, chains[i].curve_offset, thickness);
+
+        batch_push_curved_line((float)screen_x1, (float)screen_y1, (float)screen_x2, (float)screen_y2,
+                               final_curve_strength, chains[i].curve_offset, thickness, chain_color);
     }
     
     // Render fish RL vision rays BEFORE fish bodies for proper layering
@@ -665,220 +817,149 @@ void rendering_render(void) {
         }
     }
     
-    // Render all nodes (plants, fish, corpses) with enhanced visual properties
-    for (int i = 0; i < node_count; i++) {
-        if (!nodes[i].active) continue;
-        
-        // Frustum culling
-        if (nodes[i].x < world_left - NODE_RADIUS || nodes[i].x > world_right + NODE_RADIUS ||
-            nodes[i].y < world_top - NODE_RADIUS || nodes[i].y > world_bottom + NODE_RADIUS) {
-            continue;
-        }
-        
+    // Render visible nodes (plants, fish, corpses) with enhanced visual properties
+    for (int v = 0; v < g_visible_count; v++) {
+        int i = g_visible_nodes[v];
+
         int screen_x, screen_y;
         camera_world_to_screen(nodes[i].x, nodes[i].y, &screen_x, &screen_y);
-        
-        int scaled_radius = (int)(NODE_RADIUS * camera_get_zoom());
-        
+
+        float scaled_radius = NODE_RADIUS * camera_get_zoom();
+
         // Render corpse nodes with scaled size based on original fish type
         if (nodes[i].is_corpse) {
-            if (scaled_radius < 1) scaled_radius = 1;
-            
+            int decay_remaining = nodes[i].corpse_expiry_frame - simulation_get_frame_counter();
+            if (decay_remaining < 0) decay_remaining = 0;
+
             int corpse_r, corpse_g, corpse_b;
-            calculate_corpse_color(nodes[i].original_fish_type, nodes[i].corpse_decay_timer, &corpse_r, &corpse_g, &corpse_b);
-            
+            calculate_corpse_color(nodes[i].original_fish_type, decay_remaining, &corpse_r, &corpse_g, &corpse_b);
+            SDL_Color corpse_color = {(Uint8)corpse_r, (Uint8)corpse_g, (Uint8)corpse_b, 255};
+
             // Get original fish type for scaling
             FishType* original_fish_type = fish_get_type(nodes[i].original_fish_type);
             float corpse_size_factor = original_fish_type ? original_fish_type->node_size_factor : 1.0f;
-            
+
             // Apply fish size scaling to corpse (same as living fish size)
-            scaled_radius = (int)((NODE_RADIUS * 1.5f * corpse_size_factor) * camera_get_zoom());
-            if (scaled_radius < 1) scaled_radius = 1;
-            
+            scaled_radius = NODE_RADIUS * 1.5f * corpse_size_factor * camera_get_zoom();
+            if (scaled_radius < 1.0f) scaled_radius = 1.0f;
+
             // Draw corpse tail first with proper scaling
-            if (scaled_radius > 2 && original_fish_type) {
-                draw_enhanced_fish_tail(g_renderer, screen_x, screen_y, nodes[i].corpse_heading, 
-                                       original_fish_type, scaled_radius, corpse_r, corpse_g, corpse_b);
+            if (scaled_radius > 2.0f && original_fish_type) {
+                batch_push_fish_tail((float)screen_x, (float)screen_y, nodes[i].corpse_heading,
+                                     original_fish_type, scaled_radius, corpse_color);
             }
-            
-            SDL_SetRenderDrawColor(g_renderer, corpse_r, corpse_g, corpse_b, 255);
-            
+
             // Draw corpse body
-            if (scaled_radius <= 2) {
-                SDL_RenderDrawPoint(g_renderer, screen_x, screen_y);
-                if (scaled_radius > 1) {
-                    SDL_RenderDrawPoint(g_renderer, screen_x-1, screen_y);
-                    SDL_RenderDrawPoint(g_renderer, screen_x+1, screen_y);
-                    SDL_RenderDrawPoint(g_renderer, screen_x, screen_y-1);
-                    SDL_RenderDrawPoint(g_renderer, screen_x, screen_y+1);
-                }
-            } else {
-                // Draw filled circle
-                for (int dx = -scaled_radius; dx <= scaled_radius; dx++) {
-                    int dy_max = (int)sqrt(scaled_radius * scaled_radius - dx * dx);
-                    for (int dy = -dy_max; dy <= dy_max; dy++) {
-                        int px = screen_x + dx;
-                        int py = screen_y + dy;
-                        if (px >= 0 && px < WINDOW_WIDTH && py >= 0 && py < WINDOW_HEIGHT) {
-                            SDL_RenderDrawPoint(g_renderer, px, py);
-                        }
-                    }
-                }
-            }
-            
+            batch_push_circle((float)screen_x, (float)screen_y, scaled_radius, corpse_color);
+
             // Draw decay indicator for heavily decayed corpses
-            float decay_progress = 1.0f - ((float)nodes[i].corpse_decay_timer / (float)CORPSE_DECAY_TIME);
+            float decay_progress = 1.0f - ((float)decay_remaining / (float)CORPSE_DECAY_TIME);
             if (decay_progress > 0.5f) {
-                SDL_SetRenderDrawColor(g_renderer, 100, 100, 100, 255);
+                SDL_Color decay_color = {100, 100, 100, 255};
                 for (int angle = 0; angle < 360; angle += 45) {
                     float rad = angle * M_PI / 180.0f;
-                    int outline_x = screen_x + (int)(cos(rad) * scaled_radius);
-                    int outline_y = screen_y + (int)(sin(rad) * scaled_radius);
-                    SDL_RenderDrawPoint(g_renderer, outline_x, outline_y);
+                    float outline_x = screen_x + cosf(rad) * scaled_radius;
+                    float outline_y = screen_y + sinf(rad) * scaled_radius;
+                    batch_push_circle(outline_x, outline_y, 1.0f, decay_color);
                 }
             }
-            
+
             continue;
         }
-        
+
         // Render fish nodes with enhanced visual configuration
         if (nodes[i].plant_type == -1) {
             // Find fish that owns this node
             Fish* fish = find_fish_by_node_id(i);
-            
+
             if (!fish) {
                 // Skip rendering if no fish found (prevents orphaned nodes)
                 continue;
             }
-            
+
             FishType* fish_type = fish_get_type(fish->fish_type);
-            int fish_r = 255, fish_g = 165, fish_b = 0;
-            
+            SDL_Color fish_color = {255, 165, 0, 255};
+
             if (fish_type && fish_type->active) {
                 // Apply fish visual configuration with scaling
-                scaled_radius = (int)((NODE_RADIUS * 1.8f * fish_type->node_size_factor) * camera_get_zoom());
-                if (scaled_radius < 1) scaled_radius = 1;
-                
+                scaled_radius = NODE_RADIUS * 1.8f * fish_type->node_size_factor * camera_get_zoom();
+
                 // Use fish type colors
-                fish_r = fish_type->node_r;
-                fish_g = fish_type->node_g;
-                fish_b = fish_type->node_b;
+                fish_color.r = fish_type->node_r;
+                fish_color.g = fish_type->node_g;
+                fish_color.b = fish_type->node_b;
             } else {
-                scaled_radius = (int)((NODE_RADIUS * 1.8f) * camera_get_zoom());
-                if (scaled_radius < 1) scaled_radius = 1;
+                scaled_radius = NODE_RADIUS * 1.8f * camera_get_zoom();
             }
-            
-            SDL_SetRenderDrawColor(g_renderer, fish_r, fish_g, fish_b, 255);
-            
+            if (scaled_radius < 1.0f) scaled_radius = 1.0f;
+
             // Draw enhanced fish tail first (behind body)
-            if (scaled_radius > 2 && fish_type) {
-                draw_enhanced_fish_tail(g_renderer, screen_x, screen_y, fish->heading, 
-                                       fish_type, scaled_radius, fish_r, fish_g, fish_b);
+            if (scaled_radius > 2.0f && fish_type) {
+                batch_push_fish_tail((float)screen_x, (float)screen_y, fish->heading,
+                                     fish_type, scaled_radius, fish_color);
             }
-            
+
             // Draw fish body
-            if (scaled_radius <= 2) {
-                SDL_RenderDrawPoint(g_renderer, screen_x, screen_y);
-                if (scaled_radius > 1) {
-                    SDL_RenderDrawPoint(g_renderer, screen_x-1, screen_y);
-                    SDL_RenderDrawPoint(g_renderer, screen_x+1, screen_y);
-                    SDL_RenderDrawPoint(g_renderer, screen_x, screen_y-1);
-                    SDL_RenderDrawPoint(g_renderer, screen_x, screen_y+1);
-                }
-            } else {
-                // Draw filled circle for fish body
-                for (int dx = -scaled_radius; dx <= scaled_radius; dx++) {
-                    int dy_max = (int)sqrt(scaled_radius * scaled_radius - dx * dx);
-                    for (int dy = -dy_max; dy <= dy_max; dy++) {
-                        int px = screen_x + dx;
-                        int py = screen_y + dy;
-                        if (px >= 0 && px < WINDOW_WIDTH && py >= 0 && py < WINDOW_HEIGHT) {
-                            SDL_RenderDrawPoint(g_renderer, px, py);
-                        }
-                    }
-                }
-            }
-            
+            batch_push_circle((float)screen_x, (float)screen_y, scaled_radius, fish_color);
+
             continue;
-        } 
-        
+        }
+
         // Render plant nodes with enhanced visual effects
-        else {
-            int plant_type = nodes[i].plant_type;
-            PlantType* pt = plants_get_type(plant_type);
-            
-            // Apply plant size configuration
-            float size_factor = pt ? pt->node_size_factor : 1.0f;
-            scaled_radius = (int)(NODE_RADIUS * camera_get_zoom() * size_factor);
-            if (scaled_radius < 1) scaled_radius = 1;
-            
-            // Set color based on selection, aging, bleaching, and seed immunity
-            if (i == selected_node && selection_mode == 1) {
-                SDL_SetRenderDrawColor(g_renderer, 255, 255, 0, 255);
-            } else {
-                if (pt && pt->active) {
-                    int aged_r, aged_g, aged_b;
-                    calculate_aged_color(pt->node_r, pt->node_g, pt->node_b, nodes[i].age, pt->age_mature, &aged_r, &aged_g, &aged_b);
-                    
-                    // Check for coral bleaching
-                    if (temperature_is_coral_bleached(i)) {
-                        int bleached_r, bleached_g, bleached_b;
-                        calculate_bleached_color(aged_r, aged_g, aged_b, &bleached_r, &bleached_g, &bleached_b);
-                        SDL_SetRenderDrawColor(g_renderer, bleached_r, bleached_g, bleached_b, 255);
-                    } 
-                    // Check for seed immunity (pulsing effect)
-                    else if (nodes[i].seed_immunity_timer > 0) {
-                        float immunity_ratio = (float)nodes[i].seed_immunity_timer / (float)SEED_IMMUNITY_TIME;
-                        
-                        // Pulsing effect based on frame counter
-                        int pulse_frame = simulation_get_frame_counter() % 60;
-                        float pulse_factor = 0.7f + 0.3f * sin((pulse_frame / 60.0f) * 2.0f * M_PI);
-                        
-                        // Bright pulsing color for immune seeds
-                        int immune_r = (int)(255 * pulse_factor);
-                        int immune_g = (int)(255 * pulse_factor);  
-                        int immune_b = (int)(200 * pulse_factor);
-                        
-                        // Mix with original color based on immunity remaining
-                        int final_r = (int)(aged_r * (1.0f - immunity_ratio) + immune_r * immunity_ratio);
-                        int final_g = (int)(aged_g * (1.0f - immunity_ratio) + immune_g * immunity_ratio);
-                        int final_b = (int)(aged_b * (1.0f - immunity_ratio) + immune_b * immunity_ratio);
-                        
-                        SDL_SetRenderDrawColor(g_renderer, final_r, final_g, final_b, 255);
-                    } 
-                    else {
-                        SDL_SetRenderDrawColor(g_renderer, aged_r, aged_g, aged_b, 255);
-                    }
-                } else {
-                    SDL_SetRenderDrawColor(g_renderer, 150, 255, 150, 255);
-                }
+        int plant_type = nodes[i].plant_type;
+        PlantType* pt = plants_get_type(plant_type);
+
+        // Apply plant size configuration
+        float size_factor = pt ? pt->node_size_factor : 1.0f;
+        scaled_radius = NODE_RADIUS * camera_get_zoom() * size_factor;
+        if (scaled_radius < 1.0f) scaled_radius = 1.0f;
+
+        // Set color based on selection, aging, bleaching, and seed immunity
+        SDL_Color plant_color = {150, 255, 150, 255};
+        if (i == selected_node && selection_mode == 1) {
+            plant_color.r = 255; plant_color.g = 255; plant_color.b = 0;
+        } else if (pt && pt->active) {
+            int aged_r, aged_g, aged_b;
+            int node_age = simulation_get_frame_counter() - nodes[i].birth_frame;
+            calculate_aged_color(pt->node_r, pt->node_g, pt->node_b, node_age, pt->age_mature, &aged_r, &aged_g, &aged_b);
+
+            // Check for coral bleaching
+            if (temperature_is_coral_bleached(i)) {
+                int bleached_r, bleached_g, bleached_b;
+                calculate_bleached_color(aged_r, aged_g, aged_b, &bleached_r, &bleached_g, &bleached_b);
+                plant_color.r = bleached_r; plant_color.g = bleached_g; plant_color.b = bleached_b;
             }
-        }
-        
-        // Draw plant node as filled circle
-        if (scaled_radius <= 2) {
-            SDL_RenderDrawPoint(g_renderer, screen_x, screen_y);
-            if (scaled_radius > 1) {
-                SDL_RenderDrawPoint(g_renderer, screen_x-1, screen_y);
-                SDL_RenderDrawPoint(g_renderer, screen_x+1, screen_y);
-                SDL_RenderDrawPoint(g_renderer, screen_x, screen_y-1);
-                SDL_RenderDrawPoint(g_renderer, screen_x, screen_y+1);
+            // Check for seed immunity (pulsing effect)
+            else if (simulation_is_seed_immune(i)) {
+                int immunity_remaining = nodes[i].seed_immunity_until - simulation_get_frame_counter();
+                float immunity_ratio = (float)immunity_remaining / (float)SEED_IMMUNITY_TIME;
+
+                // Pulsing effect based on frame counter
+                int pulse_frame = simulation_get_frame_counter() % 60;
+                float pulse_factor = 0.7f + 0.3f * sin((pulse_frame / 60.0f) * 2.0f * M_PI);
+
+                // Bright pulsing color for immune seeds
+                int immune_r = (int)(255 * pulse_factor);
+                int immune_g = (int)(255 * pulse_factor);
+                int immune_b = (int)(200 * pulse_factor);
+
+                // Mix with original color based on immunity remaining
+                plant_color.r = (int)(aged_r * (1.0f - immunity_ratio) + immune_r * immunity_ratio);
+                plant_color.g = (int)(aged_g * (1.0f - immunity_ratio) + immune_g * immunity_ratio);
+                plant_color.b = (int)(aged_b * (1.0f - immunity_ratio) + immune_b * immunity_ratio);
             }
-        } else {
-            // Draw filled circle
-            for (int dx = -scaled_radius; dx <= scaled_radius; dx++) {
-                int dy_max = (int)sqrt(scaled_radius * scaled_radius - dx * dx);
-                for (int dy = -dy_max; dy <= dy_max; dy++) {
-                    int px = screen_x + dx;
-                    int py = screen_y + dy;
-                    if (px >= 0 && px < WINDOW_WIDTH && py >= 0 && py < WINDOW_HEIGHT) {
-                        SDL_RenderDrawPoint(g_renderer, px, py);
-                    }
-                }
+            else {
+                plant_color.r = aged_r; plant_color.g = aged_g; plant_color.b = aged_b;
             }
         }
+
+        // Draw plant node as filled circle
+        batch_push_circle((float)screen_x, (float)screen_y, scaled_radius, plant_color);
     }
-    
+
+    // Submit all visible chains and nodes in one draw call
+    batch_flush();
+
     // Draw FPS display in top-right corner
     rendering_draw_fps();
     
@@ -3,13 +3,31 @@
 #include <string.h>
 #include <math.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "types.h"
 #include "simulation.h"
 #include "grid.h"
+#ifndef HEADLESS_BUILD
 #include "camera.h"
+#endif
 #include "plants.h"
+#include "fish.h"
+#include "gas.h"
+#include "temperature.h"
+#include "lazy_alloc.h"
+
+// Core simulation data. The node- and chain-indexed arrays are backed
+// by lazily committed reservations: addresses are stable up to the
+// MAX_* capacity but physical memory grows with the population.
+static LazyBuffer g_node_buffer;
+static LazyBuffer g_chain_buffer;
+static LazyBuffer g_hot_buffers[4];
+static LazyBuffer g_free_node_buffer;
+static LazyBuffer g_free_chain_buffer;
 
-// Core simulation data
 static Node* g_nodes = NULL;
 static Chain* g_chains = NULL;
 static int g_node_count = 0;
@@ -18,15 +36,110 @@ static int g_selected_node = -1;
 static int g_selection_mode = 0;
 static int g_frame_counter = 0;
 
+// Structure-of-arrays mirror of the hot integration fields. The Node
+// array stays authoritative between frames; physics gathers into these
+// arrays, runs the vectorized kernel, and writes the results back.
+static float* g_hot_x = NULL;
+static float* g_hot_y = NULL;
+static float* g_hot_vx = NULL;
+static float* g_hot_vy = NULL;
+
+// Cached per-node physics attributes (mobility factor and derived
+// repulsion strength), written once at spawn so the force kernels read
+// flat arrays instead of chasing into the plant type table per pair
+static LazyBuffer g_mobility_buffer;
+static LazyBuffer g_repulsion_buffer;
+static float* g_node_mobility = NULL;
+static float* g_node_repulsion = NULL;
+
+// Free lists of recycled slots so removals don't grow the arrays forever
+static int* g_free_nodes = NULL;
+static int g_free_node_count = 0;
+static int* g_free_chains = NULL;
+static int g_free_chain_count = 0;
+static int g_active_node_count = 0;
+
+// Registry of live corpse node ids so decay and scavenging iterate
+// corpses directly instead of scanning the whole node array
+static int* g_corpse_ids = NULL;
+static int g_corpse_count = 0;
+static int g_corpse_capacity = 0;
+
+static int corpse_registry_append(int node_id) {
+    if (g_corpse_count >= g_corpse_capacity) {
+        int new_capacity = g_corpse_capacity > 0 ? g_corpse_capacity * 2 : 256;
+        int* new_ids = (int*)realloc(g_corpse_ids, new_capacity * sizeof(int));
+        if (!new_ids) return 0;
+        g_corpse_ids = new_ids;
+        g_corpse_capacity = new_capacity;
+    }
+    g_corpse_ids[g_corpse_count++] = node_id;
+    return 1;
+}
+
+static void corpse_registry_remove(int node_id) {
+    for (int i = 0; i < g_corpse_count; i++) {
+        if (g_corpse_ids[i] == node_id) {
+            g_corpse_ids[i] = g_corpse_ids[--g_corpse_count];
+            return;
+        }
+    }
+}
+
+// Rebuild the registry from scratch after node indices change
+// (compaction, snapshot restore)
+static void corpse_registry_rebuild(void) {
+    g_corpse_count = 0;
+    for (int i = 0; i < g_node_count; i++) {
+        if (g_nodes[i].active && g_nodes[i].plant_type == -2) {
+            corpse_registry_append(i);
+        }
+    }
+}
+
+// Commit backing pages for all node-indexed arrays up to node_count
+static int ensure_node_capacity(int node_count) {
+    if (!lazy_buffer_ensure(&g_node_buffer, node_count)) return 0;
+    if (!lazy_buffer_ensure(&g_free_node_buffer, node_count)) return 0;
+    if (!lazy_buffer_ensure(&g_mobility_buffer, node_count)) return 0;
+    if (!lazy_buffer_ensure(&g_repulsion_buffer, node_count)) return 0;
+    for (int i = 0; i < 4; i++) {
+        if (!lazy_buffer_ensure(&g_hot_buffers[i], node_count)) return 0;
+    }
+    return 1;
+}
+
 int simulation_init(void) {
-    // Allocate main simulation arrays
-    g_nodes = (Node*)calloc(MAX_NODES, sizeof(Node));
-    g_chains = (Chain*)calloc(MAX_CHAINS, sizeof(Chain));
-    
-    if (!g_nodes || !g_chains) {
-        printf("Failed to allocate memory for simulation\n");
+    // Reserve address space for the main simulation arrays; pages are
+    // committed on demand as the population grows
+    if (!lazy_buffer_init(&g_node_buffer, sizeof(Node), MAX_NODES) ||
+        !lazy_buffer_init(&g_chain_buffer, sizeof(Chain), MAX_CHAINS) ||
+        !lazy_buffer_init(&g_hot_buffers[0], sizeof(float), MAX_NODES) ||
+        !lazy_buffer_init(&g_hot_buffers[1], sizeof(float), MAX_NODES) ||
+        !lazy_buffer_init(&g_hot_buffers[2], sizeof(float), MAX_NODES) ||
+        !lazy_buffer_init(&g_hot_buffers[3], sizeof(float), MAX_NODES) ||
+        !lazy_buffer_init(&g_free_node_buffer, sizeof(int), MAX_NODES) ||
+        !lazy_buffer_init(&g_free_chain_buffer, sizeof(int), MAX_CHAINS) ||
+        !lazy_buffer_init(&g_mobility_buffer, sizeof(float), MAX_NODES) ||
+        !lazy_buffer_init(&g_repulsion_buffer, sizeof(float), MAX_NODES)) {
+        printf("Failed to reserve memory for simulation\n");
         return 0;
     }
+
+    g_nodes = (Node*)g_node_buffer.base;
+    g_chains = (Chain*)g_chain_buffer.base;
+    g_hot_x = (float*)g_hot_buffers[0].base;
+    g_hot_y = (float*)g_hot_buffers[1].base;
+    g_hot_vx = (float*)g_hot_buffers[2].base;
+    g_hot_vy = (float*)g_hot_buffers[3].base;
+    g_free_nodes = (int*)g_free_node_buffer.base;
+    g_free_chains = (int*)g_free_chain_buffer.base;
+    g_node_mobility = (float*)g_mobility_buffer.base;
+    g_node_repulsion = (float*)g_repulsion_buffer.base;
+
+    g_free_node_count = 0;
+    g_free_chain_count = 0;
+    g_active_node_count = 0;
     
     // Initialize state
     g_node_count = 0;
@@ -46,32 +159,61 @@ int simulation_init(void) {
 }
 
 void simulation_cleanup(void) {
-    if (g_nodes) {
-        free(g_nodes);
-        g_nodes = NULL;
+    lazy_buffer_cleanup(&g_node_buffer);
+    lazy_buffer_cleanup(&g_chain_buffer);
+    for (int i = 0; i < 4; i++) {
+        lazy_buffer_cleanup(&g_hot_buffers[i]);
     }
-    if (g_chains) {
-        free(g_chains);
-        g_chains = NULL;
+    lazy_buffer_cleanup(&g_free_node_buffer);
+    lazy_buffer_cleanup(&g_free_chain_buffer);
+    lazy_buffer_cleanup(&g_mobility_buffer);
+    lazy_buffer_cleanup(&g_repulsion_buffer);
+
+    g_nodes = NULL;
+    g_chains = NULL;
+    g_hot_x = NULL;
+    g_hot_y = NULL;
+    g_hot_vx = NULL;
+    g_hot_vy = NULL;
+    g_free_nodes = NULL;
+    g_free_chains = NULL;
+    g_node_mobility = NULL;
+    g_node_repulsion = NULL;
+
+    if (g_corpse_ids) {
+        free(g_corpse_ids);
+        g_corpse_ids = NULL;
     }
-    
+    g_corpse_count = 0;
+    g_corpse_capacity = 0;
+
     grid_cleanup();
 }
 
-// Create new node with world bounds clamping
+// Create new node with world bounds clamping, recycling freed slots
 int simulation_add_node(float x, float y, int plant_type) {
-    if (g_node_count >= MAX_NODES) {
+    int node_index;
+
+    if (g_free_node_count > 0) {
+        node_index = g_free_nodes[--g_free_node_count];
+    } else if (g_node_count < MAX_NODES) {
+        if (!ensure_node_capacity(g_node_count + 1)) {
+            printf("Failed to grow node arrays\n");
+            return -1;
+        }
+        node_index = g_node_count++;
+    } else {
         printf("Maximum nodes reached\n");
         return -1;
     }
-    
+
     // Ensure node stays within world bounds
     if (x < WORLD_LEFT) x = WORLD_LEFT;
     if (x > WORLD_RIGHT) x = WORLD_RIGHT;
     if (y < WORLD_TOP) y = WORLD_TOP;
     if (y > WORLD_BOTTOM) y = WORLD_BOTTOM;
-    
-    Node* node = &g_nodes[g_node_count];
+
+    Node* node = &g_nodes[node_index];
     node->x = x;
     node->y = y;
     node->vx = 0;
@@ -80,40 +222,83 @@ int simulation_add_node(float x, float y, int plant_type) {
     node->can_grow = 1;
     node->plant_type = plant_type;  // -1 for fish, -2 for corpse, >=0 for plants
     node->branch_count = 0;
-    node->age = 0;
-    
+    node->birth_frame = g_frame_counter;
+
     // Initialize corpse system fields
     node->is_corpse = 0;
-    node->corpse_decay_timer = 0;
+    node->corpse_expiry_frame = 0;
     node->original_fish_type = -1;
     node->corpse_heading = 0.0f;
-    
+
     // Initialize seed immunity (new plants start unprotected)
-    node->seed_immunity_timer = 0;
+    node->seed_immunity_until = 0;
     
     // Initialize nutrition storage
     node->stored_nutrition = 0.0f;
-    
+
+    // Cache physics attributes: fish and corpses are fully mobile,
+    // plants use their configured mobility factor. The cross-cell
+    // repulsion kernel derives its strength from mobility.
+    float mobility = 1.0f;
+    if (plant_type >= 0) {
+        PlantType* pt = plants_get_type(plant_type);
+        if (pt) mobility = pt->mobility_factor;
+    }
+    g_node_mobility[node_index] = mobility;
+    g_node_repulsion[node_index] = 2.0f - mobility;
+
     // Handle special node types
     if (plant_type == -2) {
-        // Corpse node - cannot grow
+        // Corpse node - cannot grow, tracked in the corpse registry
         node->can_grow = 0;
+        corpse_registry_append(node_index);
     } else if (plant_type == -1) {
         // Fish node - cannot grow
         node->can_grow = 0;
     } else if (plant_type >= 0) {
         // Plant node - calculate nutrition cost
-        plants_initialize_nutrition_cost(g_node_count, plant_type);
+        plants_initialize_nutrition_cost(node_index, plant_type);
+
+        // New producer: oxygen field around it must be rebuilt
+        gas_mark_plant_changed(x, y, plant_type);
+
+        // Fresh plants can grow until they saturate or age out
+        plants_register_growth_candidate(node_index);
+    }
+
+    g_active_node_count++;
+    return node_index;
+}
+
+// Deactivate a node and recycle its slot
+void simulation_remove_node(int node_index) {
+    if (node_index < 0 || node_index >= g_node_count) return;
+    if (!g_nodes[node_index].active) return;
+
+    g_nodes[node_index].active = 0;
+    grid_update_node(node_index);
+
+    // Removed producer: oxygen field around it must be rebuilt
+    if (g_nodes[node_index].plant_type >= 0) {
+        gas_mark_plant_changed(g_nodes[node_index].x, g_nodes[node_index].y,
+                               g_nodes[node_index].plant_type);
+    } else if (g_nodes[node_index].plant_type == -2) {
+        corpse_registry_remove(node_index);
+    }
+
+    g_free_nodes[g_free_node_count++] = node_index;
+    g_active_node_count--;
+
+    if (g_selected_node == node_index) {
+        simulation_clear_selection();
     }
-    
-    return g_node_count++;
 }
 
 // Create seed node with temporary immunity from being eaten
 int simulation_add_seed_node(float x, float y, int plant_type) {
     int node_id = simulation_add_node(x, y, plant_type);
     if (node_id >= 0) {
-        g_nodes[node_id].seed_immunity_timer = SEED_IMMUNITY_TIME;
+        g_nodes[node_id].seed_immunity_until = g_frame_counter + SEED_IMMUNITY_TIME;
         printf("Created immune seed %s at (%.0f, %.0f) - immune for %d frames\n",
                plants_get_type(plant_type) ? plants_get_type(plant_type)->name : "Unknown", 
                x, y, SEED_IMMUNITY_TIME);
@@ -123,10 +308,6 @@ int simulation_add_seed_node(float x, float y, int plant_type) {
 
 // Create chain connection between two plant nodes
 int simulation_add_chain(int node1, int node2) {
-    if (g_chain_count >= MAX_CHAINS) {
-        printf("Maximum chains reached\n");
-        return -1;
-    }
     if (node1 == node2) return -1;
     if (node1 < 0 || node1 >= g_node_count) return -1;
     if (node2 < 0 || node2 >= g_node_count) return -1;
@@ -146,12 +327,27 @@ int simulation_add_chain(int node1, int node2) {
         }
     }
     
-    Chain* chain = &g_chains[g_chain_count];
+    int chain_index;
+    if (g_free_chain_count > 0) {
+        chain_index = g_free_chains[--g_free_chain_count];
+    } else if (g_chain_count < MAX_CHAINS) {
+        if (!lazy_buffer_ensure(&g_chain_buffer, g_chain_count + 1) ||
+            !lazy_buffer_ensure(&g_free_chain_buffer, g_chain_count + 1)) {
+            printf("Failed to grow chain arrays\n");
+            return -1;
+        }
+        chain_index = g_chain_count++;
+    } else {
+        printf("Maximum chains reached\n");
+        return -1;
+    }
+
+    Chain* chain = &g_chains[chain_index];
     chain->node1 = node1;
     chain->node2 = node2;
     chain->active = 1;
     chain->plant_type = g_nodes[node1].plant_type;
-    chain->age = 0;
+    chain->birth_frame = g_frame_counter;
     
     // Generate visual curve parameters based on plant type
     PlantType* plant_type = plants_get_type(g_nodes[node1].plant_type);
@@ -160,37 +356,171 @@ int simulation_add_chain(int node1, int node2) {
     chain->curve_strength = ((float)rand() / RAND_MAX - 0.5f) * 0.6f;
     chain->curve_offset = ((float)rand() / RAND_MAX - 0.5f) * 20.0f;
     chain->curve_multiplier = curvature_factor * (0.8f + ((float)rand() / RAND_MAX) * 0.4f);
-    
-    return g_chain_count++;
+
+    return chain_index;
 }
 
-// Update seed immunity timers each frame
-void simulation_update_seed_timers(void) {
-    int seeds_matured = 0;
-    
+// Deactivate a chain and recycle its slot
+void simulation_remove_chain(int chain_index) {
+    if (chain_index < 0 || chain_index >= g_chain_count) return;
+    if (!g_chains[chain_index].active) return;
+
+    g_chains[chain_index].active = 0;
+    g_free_chains[g_free_chain_count++] = chain_index;
+}
+
+// Compact the node and chain arrays when fragmentation gets high: move
+// live entries down over the holes, remap chain endpoints and fish
+// node_ids, and rebuild the spatial grid. Returns 1 when a compaction
+// ran (the caller can skip its own grid rebuild in that case).
+int simulation_maybe_compact(void) {
+    // Only worth the remap cost when most of the array is dead slots
+    if (g_node_count < 10000) return 0;
+    if (g_active_node_count * 2 > g_node_count) return 0;
+
+    int* remap = (int*)malloc(g_node_count * sizeof(int));
+    if (!remap) return 0;
+
+    // Drop chains whose endpoints are already gone
+    for (int i = 0; i < g_chain_count; i++) {
+        if (!g_chains[i].active) continue;
+        if (!g_nodes[g_chains[i].node1].active || !g_nodes[g_chains[i].node2].active) {
+            g_chains[i].active = 0;
+        }
+    }
+
+    // Slide live nodes down over the holes
+    int write = 0;
+    for (int read = 0; read < g_node_count; read++) {
+        if (!g_nodes[read].active) {
+            remap[read] = -1;
+            continue;
+        }
+        if (write != read) {
+            g_nodes[write] = g_nodes[read];
+            g_node_mobility[write] = g_node_mobility[read];
+            g_node_repulsion[write] = g_node_repulsion[read];
+            temperature_move_bleach_state(read, write);
+        }
+        remap[read] = write;
+        write++;
+    }
+
+    int old_count = g_node_count;
+    g_node_count = write;
+    g_free_node_count = 0;
+
+    // Compact chains and remap their endpoints
+    int chain_write = 0;
+    for (int read = 0; read < g_chain_count; read++) {
+        if (!g_chains[read].active) continue;
+
+        Chain chain = g_chains[read];
+        chain.node1 = remap[chain.node1];
+        chain.node2 = remap[chain.node2];
+        if (chain.node1 < 0 || chain.node2 < 0) continue;
+
+        g_chains[chain_write++] = chain;
+    }
+    g_chain_count = chain_write;
+    g_free_chain_count = 0;
+
+    // Remap fish back-references to their nodes
+    Fish* all_fish = fish_get_all();
+    int highest_slot = fish_get_highest_slot();
+    for (int i = 0; i <= highest_slot; i++) {
+        if (!all_fish[i].active) continue;
+        if (all_fish[i].node_id >= 0 && all_fish[i].node_id < old_count) {
+            all_fish[i].node_id = remap[all_fish[i].node_id];
+        }
+    }
+    fish_refresh_node_lookup();
+
+    // Remap selection
+    if (g_selected_node >= 0 && g_selected_node < old_count) {
+        g_selected_node = remap[g_selected_node];
+        if (g_selected_node < 0) simulation_clear_selection();
+    }
+
+    free(remap);
+    grid_rebuild();
+    plants_refresh_growth_candidates();
+    corpse_registry_rebuild();
+
+    printf("Compacted simulation arrays: %d -> %d nodes, %d chains\n",
+           old_count, g_node_count, g_chain_count);
+    return 1;
+}
+
+// Replace the live world with snapshot data: copy the node and chain
+// arrays, then rebuild everything derived from them (free lists, cached
+// physics attributes, active count, spatial grid).
+int simulation_snapshot_restore(const Node* nodes, int node_count,
+                                const Chain* chains, int chain_count,
+                                int frame_counter) {
+    if (node_count < 0 || node_count > MAX_NODES) return 0;
+    if (chain_count < 0 || chain_count > MAX_CHAINS) return 0;
+
+    if (!ensure_node_capacity(node_count) ||
+        !lazy_buffer_ensure(&g_chain_buffer, chain_count) ||
+        !lazy_buffer_ensure(&g_free_chain_buffer, chain_count)) {
+        printf("Failed to grow arrays for snapshot restore\n");
+        return 0;
+    }
+
+    memcpy(g_nodes, nodes, (size_t)node_count * sizeof(Node));
+    memcpy(g_chains, chains, (size_t)chain_count * sizeof(Chain));
+    g_node_count = node_count;
+    g_chain_count = chain_count;
+    g_frame_counter = frame_counter;
+
+    // Rebuild free lists and cached attributes from the restored arrays
+    g_free_node_count = 0;
+    g_active_node_count = 0;
     for (int i = 0; i < g_node_count; i++) {
-        if (!g_nodes[i].active) continue;
-        if (g_nodes[i].plant_type < 0) continue;  // Skip fish and corpse nodes
-        if (g_nodes[i].seed_immunity_timer <= 0) continue;  // Skip non-immune nodes
-        
-        g_nodes[i].seed_immunity_timer--;
-        
-        if (g_nodes[i].seed_immunity_timer == 0) {
-            seeds_matured++;
+        if (!g_nodes[i].active) {
+            g_free_nodes[g_free_node_count++] = i;
+            continue;
+        }
+
+        float mobility = 1.0f;
+        if (g_nodes[i].plant_type >= 0) {
+            PlantType* pt = plants_get_type(g_nodes[i].plant_type);
+            if (pt) mobility = pt->mobility_factor;
         }
+        g_node_mobility[i] = mobility;
+        g_node_repulsion[i] = 2.0f - mobility;
+        g_active_node_count++;
     }
-    
-    // Log seed maturation periodically
-    static int last_seed_log = 0;
-    if (seeds_matured > 0 && (g_frame_counter - last_seed_log) > 300) {
-        printf("Seeds matured: %d seeds are now edible\n", seeds_matured);
-        last_seed_log = g_frame_counter;
+
+    g_free_chain_count = 0;
+    for (int i = 0; i < g_chain_count; i++) {
+        if (!g_chains[i].active) {
+            g_free_chains[g_free_chain_count++] = i;
+        }
     }
+
+    simulation_clear_selection();
+    grid_rebuild();
+    plants_refresh_growth_candidates();
+    corpse_registry_rebuild();
+    return 1;
+}
+
+// Check whether a seed is still protected from being eaten. Immunity
+// is an absolute expiry frame, so no per-frame timer pass is needed.
+int simulation_is_seed_immune(int node_index) {
+    if (node_index < 0 || node_index >= g_node_count) return 0;
+    return g_frame_counter < g_nodes[node_index].seed_immunity_until;
 }
 
 // Find node at world position (for mouse interaction)
 int simulation_find_node_at_position(float world_x, float world_y) {
+#ifndef HEADLESS_BUILD
     float threshold = NODE_RADIUS * 2 / camera_get_zoom();
+#else
+    float threshold = NODE_RADIUS * 2;
+#endif
     
     // Use spatial grid for efficient lookup
     GridCell* cells[9];
@@ -220,13 +550,64 @@ int simulation_find_node_at_position(float world_x, float world_y) {
 // Frame counter management
 void simulation_update_frame_counter(void) {
     g_frame_counter++;
-    simulation_update_seed_timers();
 }
 
 int simulation_get_frame_counter(void) {
     return g_frame_counter;
 }
 
+// Gather hot fields from the Node array into the SoA mirror. Inactive
+// nodes get zero velocity so the kernel leaves their positions alone.
+void simulation_gather_hot_arrays(void) {
+    for (int i = 0; i < g_node_count; i++) {
+        g_hot_x[i] = g_nodes[i].x;
+        g_hot_y[i] = g_nodes[i].y;
+        if (g_nodes[i].active) {
+            g_hot_vx[i] = g_nodes[i].vx;
+            g_hot_vy[i] = g_nodes[i].vy;
+        } else {
+            g_hot_vx[i] = 0.0f;
+            g_hot_vy[i] = 0.0f;
+        }
+    }
+}
+
+// Vectorized drag-and-integrate kernel: v *= drag, p += v
+void simulation_integrate_hot_arrays(float drag) {
+    int i = 0;
+
+#ifdef __SSE2__
+    __m128 drag_v = _mm_set1_ps(drag);
+
+    for (; i + 4 <= g_node_count; i += 4) {
+        __m128 vx = _mm_mul_ps(_mm_loadu_ps(&g_hot_vx[i]), drag_v);
+        __m128 vy = _mm_mul_ps(_mm_loadu_ps(&g_hot_vy[i]), drag_v);
+        _mm_storeu_ps(&g_hot_vx[i], vx);
+        _mm_storeu_ps(&g_hot_vy[i], vy);
+        _mm_storeu_ps(&g_hot_x[i], _mm_add_ps(_mm_loadu_ps(&g_hot_x[i]), vx));
+        _mm_storeu_ps(&g_hot_y[i], _mm_add_ps(_mm_loadu_ps(&g_hot_y[i]), vy));
+    }
+#endif
+
+    for (; i < g_node_count; i++) {
+        g_hot_vx[i] *= drag;
+        g_hot_vy[i] *= drag;
+        g_hot_x[i] += g_hot_vx[i];
+        g_hot_y[i] += g_hot_vy[i];
+    }
+}
+
+// Write integrated positions and velocities back to the Node array
+void simulation_scatter_hot_arrays(void) {
+    for (int i = 0; i < g_node_count; i++) {
+        if (!g_nodes[i].active) continue;
+        g_nodes[i].x = g_hot_x[i];
+        g_nodes[i].y = g_hot_y[i];
+        g_nodes[i].vx = g_hot_vx[i];
+        g_nodes[i].vy = g_hot_vy[i];
+    }
+}
+
 // Accessor functions
 Node* simulation_get_nodes(void) {
     return g_nodes;
@@ -240,10 +621,30 @@ int simulation_get_node_count(void) {
     return g_node_count;
 }
 
+int simulation_get_active_node_count(void) {
+    return g_active_node_count;
+}
+
+int simulation_get_corpse_count(void) {
+    return g_corpse_count;
+}
+
+const int* simulation_get_corpse_ids(void) {
+    return g_corpse_ids;
+}
+
 int simulation_get_chain_count(void) {
     return g_chain_count;
 }
 
+float* simulation_get_node_mobility(void) {
+    return g_node_mobility;
+}
+
+float* simulation_get_node_repulsion(void) {
+    return g_node_repulsion;
+}
+
 // Selection system for manual plant chaining
 int simulation_get_selected_node(void) {
     return g_selected_node;
@@ -0,0 +1,309 @@
+// For ftruncate under -std=c99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "types.h"
+#include "snapshot.h"
+#include "simulation.h"
+#include "nutrition.h"
+#include "gas.h"
+#include "fish.h"
+#include "temperature.h"
+
+#define SNAPSHOT_MAGIC 0x4E534254u  // "TBSN"
+// Version 2: lifecycle fields hold absolute frames (birth_frame,
+// corpse_expiry_frame, seed_immunity_until) instead of counters
+// Version 3: coral bleach bitset appended after the oxygen grid
+#define SNAPSHOT_VERSION 3u
+
+// Fixed-size header followed by the raw sections in order: nodes,
+// chains, fish, nutrition grid, original nutrition grid, oxygen grid,
+// coral bleach bitset. Struct sizes are stored so a snapshot from a
+// different build of the simulation is rejected instead of
+// misinterpreted.
+typedef struct {
+    unsigned int magic;
+    unsigned int version;
+    unsigned int node_size;
+    unsigned int chain_size;
+    unsigned int fish_size;
+    int node_count;
+    int chain_count;
+    int fish_count;
+    int nutrition_cells;
+    int gas_cells;
+    int bleach_words;
+    int frame_counter;
+} SnapshotHeader;
+
+// Map a file for writing at the requested size (creating or truncating
+// it) or for reading at its current size when size is 0. Returns NULL
+// on failure; *out_size receives the mapped length.
+#ifdef _WIN32
+typedef struct {
+    HANDLE file_handle;
+    HANDLE mapping_handle;
+} SnapshotMapping;
+#else
+typedef struct {
+    int fd;
+} SnapshotMapping;
+#endif
+
+static void* map_snapshot_file(const char* filename, size_t size, int writable,
+                               SnapshotMapping* mapping, size_t* out_size) {
+    void* base = NULL;
+
+#ifdef _WIN32
+    mapping->file_handle = CreateFileA(filename,
+                                       writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                                       FILE_SHARE_READ, NULL,
+                                       writable ? CREATE_ALWAYS : OPEN_EXISTING,
+                                       FILE_ATTRIBUTE_NORMAL, NULL);
+    if (mapping->file_handle == INVALID_HANDLE_VALUE) return NULL;
+
+    if (!writable) {
+        DWORD file_size = GetFileSize(mapping->file_handle, NULL);
+        if (file_size == INVALID_FILE_SIZE) {
+            CloseHandle(mapping->file_handle);
+            mapping->file_handle = INVALID_HANDLE_VALUE;
+            return NULL;
+        }
+        size = file_size;
+    }
+
+    mapping->mapping_handle = CreateFileMappingA(mapping->file_handle, NULL,
+                                                 writable ? PAGE_READWRITE : PAGE_READONLY,
+                                                 0, (DWORD)size, NULL);
+    if (!mapping->mapping_handle) {
+        CloseHandle(mapping->file_handle);
+        mapping->file_handle = INVALID_HANDLE_VALUE;
+        return NULL;
+    }
+
+    base = MapViewOfFile(mapping->mapping_handle,
+                         writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, size);
+#else
+    mapping->fd = open(filename,
+                       writable ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDONLY, 0644);
+    if (mapping->fd < 0) return NULL;
+
+    if (writable) {
+        if (ftruncate(mapping->fd, size) != 0) {
+            close(mapping->fd);
+            mapping->fd = -1;
+            return NULL;
+        }
+    } else {
+        struct stat st;
+        if (fstat(mapping->fd, &st) != 0) {
+            close(mapping->fd);
+            mapping->fd = -1;
+            return NULL;
+        }
+        size = (size_t)st.st_size;
+    }
+
+    base = mmap(NULL, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                writable ? MAP_SHARED : MAP_PRIVATE, mapping->fd, 0);
+    if (base == MAP_FAILED) base = NULL;
+#endif
+
+    if (!base) {
+#ifdef _WIN32
+        CloseHandle(mapping->mapping_handle);
+        mapping->mapping_handle = NULL;
+        CloseHandle(mapping->file_handle);
+        mapping->file_handle = INVALID_HANDLE_VALUE;
+#else
+        close(mapping->fd);
+        mapping->fd = -1;
+#endif
+        return NULL;
+    }
+
+    *out_size = size;
+    return base;
+}
+
+static void unmap_snapshot_file(void* base, size_t size, SnapshotMapping* mapping) {
+#ifdef _WIN32
+    (void)size;
+    UnmapViewOfFile(base);
+    CloseHandle(mapping->mapping_handle);
+    CloseHandle(mapping->file_handle);
+#else
+    munmap(base, size);
+    close(mapping->fd);
+#endif
+}
+
+int snapshot_save(const char* filename) {
+    int node_count = simulation_get_node_count();
+    int chain_count = simulation_get_chain_count();
+    int fish_count = fish_get_highest_slot() + 1;
+    int nutrition_cells = nutrition_get_grid_cell_count();
+    int gas_cells = gas_get_grid_cell_count();
+    int bleach_words = temperature_snapshot_word_count(node_count);
+
+    size_t total = sizeof(SnapshotHeader)
+                 + (size_t)node_count * sizeof(Node)
+                 + (size_t)chain_count * sizeof(Chain)
+                 + (size_t)fish_count * sizeof(Fish)
+                 + (size_t)nutrition_cells * 2 * sizeof(float)
+                 + (size_t)gas_cells * sizeof(float)
+                 + (size_t)bleach_words * sizeof(unsigned int);
+
+    SnapshotMapping mapping;
+    size_t mapped_size;
+    unsigned char* base = map_snapshot_file(filename, total, 1, &mapping, &mapped_size);
+    if (!base) {
+        printf("Snapshot save failed: cannot map %s\n", filename);
+        return 0;
+    }
+
+    SnapshotHeader* header = (SnapshotHeader*)base;
+    header->magic = SNAPSHOT_MAGIC;
+    header->version = SNAPSHOT_VERSION;
+    header->node_size = sizeof(Node);
+    header->chain_size = sizeof(Chain);
+    header->fish_size = sizeof(Fish);
+    header->node_count = node_count;
+    header->chain_count = chain_count;
+    header->fish_count = fish_count;
+    header->nutrition_cells = nutrition_cells;
+    header->gas_cells = gas_cells;
+    header->bleach_words = bleach_words;
+    header->frame_counter = simulation_get_frame_counter();
+
+    unsigned char* cursor = base + sizeof(SnapshotHeader);
+
+    memcpy(cursor, simulation_get_nodes(), (size_t)node_count * sizeof(Node));
+    cursor += (size_t)node_count * sizeof(Node);
+
+    memcpy(cursor, simulation_get_chains(), (size_t)chain_count * sizeof(Chain));
+    cursor += (size_t)chain_count * sizeof(Chain);
+
+    memcpy(cursor, fish_get_all(), (size_t)fish_count * sizeof(Fish));
+    cursor += (size_t)fish_count * sizeof(Fish);
+
+    memcpy(cursor, nutrition_get_grid(), (size_t)nutrition_cells * sizeof(float));
+    cursor += (size_t)nutrition_cells * sizeof(float);
+
+    memcpy(cursor, nutrition_get_original_grid(), (size_t)nutrition_cells * sizeof(float));
+    cursor += (size_t)nutrition_cells * sizeof(float);
+
+    memcpy(cursor, gas_get_grid(), (size_t)gas_cells * sizeof(float));
+    cursor += (size_t)gas_cells * sizeof(float);
+
+    temperature_snapshot_write((unsigned int*)cursor, bleach_words);
+
+    unmap_snapshot_file(base, mapped_size, &mapping);
+
+    printf("Snapshot saved: %s (%d nodes, %d chains, %d fish, %.1f MB)\n",
+           filename, node_count, chain_count, fish_count,
+           total / (1024.0f * 1024.0f));
+    return 1;
+}
+
+int snapshot_load(const char* filename) {
+    SnapshotMapping mapping;
+    size_t mapped_size;
+    unsigned char* base = map_snapshot_file(filename, 0, 0, &mapping, &mapped_size);
+    if (!base) {
+        printf("Snapshot load failed: cannot map %s\n", filename);
+        return 0;
+    }
+
+    if (mapped_size < sizeof(SnapshotHeader)) {
+        printf("Snapshot load failed: %s is truncated\n", filename);
+        unmap_snapshot_file(base, mapped_size, &mapping);
+        return 0;
+    }
+
+    SnapshotHeader header = *(SnapshotHeader*)base;
+
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION) {
+        printf("Snapshot load failed: %s is not a version %u snapshot\n",
+               filename, SNAPSHOT_VERSION);
+        unmap_snapshot_file(base, mapped_size, &mapping);
+        return 0;
+    }
+
+    if (header.node_size != sizeof(Node) || header.chain_size != sizeof(Chain) ||
+        header.fish_size != sizeof(Fish)) {
+        printf("Snapshot load failed: %s was written by an incompatible build\n", filename);
+        unmap_snapshot_file(base, mapped_size, &mapping);
+        return 0;
+    }
+
+    if (header.nutrition_cells != nutrition_get_grid_cell_count() ||
+        header.gas_cells != gas_get_grid_cell_count() ||
+        header.node_count < 0 || header.chain_count < 0 ||
+        header.fish_count < 0 || header.fish_count > MAX_FISH ||
+        header.bleach_words != temperature_snapshot_word_count(header.node_count)) {
+        printf("Snapshot load failed: %s does not match this world configuration\n", filename);
+        unmap_snapshot_file(base, mapped_size, &mapping);
+        return 0;
+    }
+
+    size_t expected = sizeof(SnapshotHeader)
+                    + (size_t)header.node_count * sizeof(Node)
+                    + (size_t)header.chain_count * sizeof(Chain)
+                    + (size_t)header.fish_count * sizeof(Fish)
+                    + (size_t)header.nutrition_cells * 2 * sizeof(float)
+                    + (size_t)header.gas_cells * sizeof(float)
+                    + (size_t)header.bleach_words * sizeof(unsigned int);
+    if (mapped_size < expected) {
+        printf("Snapshot load failed: %s is truncated\n", filename);
+        unmap_snapshot_file(base, mapped_size, &mapping);
+        return 0;
+    }
+
+    unsigned char* cursor = base + sizeof(SnapshotHeader);
+    const Node* nodes = (const Node*)cursor;
+    cursor += (size_t)header.node_count * sizeof(Node);
+    const Chain* chains = (const Chain*)cursor;
+    cursor += (size_t)header.chain_count * sizeof(Chain);
+    const Fish* fish = (const Fish*)cursor;
+    cursor += (size_t)header.fish_count * sizeof(Fish);
+    const float* nutrition_grid = (const float*)cursor;
+    cursor += (size_t)header.nutrition_cells * sizeof(float);
+    const float* original_grid = (const float*)cursor;
+    cursor += (size_t)header.nutrition_cells * sizeof(float);
+    const float* oxygen_grid = (const float*)cursor;
+    cursor += (size_t)header.gas_cells * sizeof(float);
+    const unsigned int* bleach_bits = (const unsigned int*)cursor;
+
+    // Nodes first so the fish node references point at restored data
+    if (!simulation_snapshot_restore(nodes, header.node_count,
+                                     chains, header.chain_count,
+                                     header.frame_counter)) {
+        printf("Snapshot load failed: could not restore simulation arrays\n");
+        unmap_snapshot_file(base, mapped_size, &mapping);
+        return 0;
+    }
+
+    fish_snapshot_restore(fish, header.fish_count);
+    nutrition_snapshot_restore(nutrition_grid, original_grid);
+    gas_snapshot_restore(oxygen_grid);
+    temperature_snapshot_restore(bleach_bits, header.bleach_words);
+
+    unmap_snapshot_file(base, mapped_size, &mapping);
+
+    printf("Snapshot loaded: %s (%d nodes, %d chains, %d fish, frame %d)\n",
+           filename, header.node_count, header.chain_count, header.fish_count,
+           header.frame_counter);
+    return 1;
+}
@@ -0,0 +1,167 @@
+// For ftruncate under -std=c99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "stats_shm.h"
+#include "profiler.h"
+
+#define STATS_SHM_FILE "simulation_stats.shm"
+#define STATS_SHM_MAGIC 0x54425354u  // "TBST"
+#define STATS_SHM_LAYOUT_VERSION 1u
+
+// All members are 4 bytes so the layout has no padding and the Python
+// monitor can compute offsets from stage_count alone
+typedef struct {
+    unsigned int magic;
+    unsigned int layout_version;
+    volatile unsigned int sequence;        // odd while the engine writes
+    unsigned int stage_count;
+    float nutrition;
+    float fish_count;
+    float plant_count;
+    float temperature;
+    float bleached_count;
+    float stage_ms[PROF_STAGE_COUNT * 2];  // (p50, p95) per stage
+    volatile float control_temperature;    // written by the monitor
+    volatile unsigned int control_sequence;
+} StatsShmBlock;
+
+static StatsShmBlock* g_block = NULL;
+static unsigned int g_last_control_sequence = 0;
+
+#ifdef _WIN32
+static HANDLE g_file_handle = INVALID_HANDLE_VALUE;
+static HANDLE g_mapping_handle = NULL;
+#else
+static int g_fd = -1;
+#endif
+
+int stats_shm_init(void) {
+#ifdef _WIN32
+    g_file_handle = CreateFileA(STATS_SHM_FILE, GENERIC_READ | GENERIC_WRITE,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                                CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (g_file_handle == INVALID_HANDLE_VALUE) {
+        printf("Failed to create stats shared memory file\n");
+        return 0;
+    }
+
+    g_mapping_handle = CreateFileMappingA(g_file_handle, NULL, PAGE_READWRITE,
+                                          0, sizeof(StatsShmBlock), NULL);
+    if (!g_mapping_handle) {
+        printf("Failed to create stats file mapping\n");
+        CloseHandle(g_file_handle);
+        g_file_handle = INVALID_HANDLE_VALUE;
+        return 0;
+    }
+
+    g_block = (StatsShmBlock*)MapViewOfFile(g_mapping_handle, FILE_MAP_ALL_ACCESS,
+                                            0, 0, sizeof(StatsShmBlock));
+#else
+    g_fd = open(STATS_SHM_FILE, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (g_fd < 0) {
+        printf("Failed to create stats shared memory file\n");
+        return 0;
+    }
+
+    if (ftruncate(g_fd, sizeof(StatsShmBlock)) != 0) {
+        printf("Failed to size stats shared memory file\n");
+        close(g_fd);
+        g_fd = -1;
+        return 0;
+    }
+
+    g_block = (StatsShmBlock*)mmap(NULL, sizeof(StatsShmBlock),
+                                   PROT_READ | PROT_WRITE, MAP_SHARED, g_fd, 0);
+    if (g_block == MAP_FAILED) g_block = NULL;
+#endif
+
+    if (!g_block) {
+        printf("Failed to map stats shared memory\n");
+        stats_shm_cleanup();
+        return 0;
+    }
+
+    memset(g_block, 0, sizeof(StatsShmBlock));
+    g_block->layout_version = STATS_SHM_LAYOUT_VERSION;
+    g_block->stage_count = PROF_STAGE_COUNT;
+    // Magic is written last so the monitor never maps a half-built block
+    g_block->magic = STATS_SHM_MAGIC;
+
+    printf("Stats shared memory mapped: %s (%u bytes, %d stages)\n",
+           STATS_SHM_FILE, (unsigned int)sizeof(StatsShmBlock), PROF_STAGE_COUNT);
+    return 1;
+}
+
+void stats_shm_cleanup(void) {
+#ifdef _WIN32
+    if (g_block) {
+        UnmapViewOfFile((void*)g_block);
+        g_block = NULL;
+    }
+    if (g_mapping_handle) {
+        CloseHandle(g_mapping_handle);
+        g_mapping_handle = NULL;
+    }
+    if (g_file_handle != INVALID_HANDLE_VALUE) {
+        CloseHandle(g_file_handle);
+        g_file_handle = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (g_block) {
+        munmap(g_block, sizeof(StatsShmBlock));
+        g_block = NULL;
+    }
+    if (g_fd >= 0) {
+        close(g_fd);
+        g_fd = -1;
+    }
+#endif
+    remove(STATS_SHM_FILE);
+}
+
+void stats_shm_publish(float nutrition, int fish_count, int plant_count,
+                       float temperature, int bleached_count) {
+    if (!g_block) return;
+
+    // Seqlock write: odd sequence marks the block as mid-update so the
+    // reader retries instead of consuming a torn snapshot
+    g_block->sequence++;
+
+    g_block->nutrition = nutrition;
+    g_block->fish_count = (float)fish_count;
+    g_block->plant_count = (float)plant_count;
+    g_block->temperature = temperature;
+    g_block->bleached_count = (float)bleached_count;
+
+    for (int i = 0; i < PROF_STAGE_COUNT; i++) {
+        g_block->stage_ms[i * 2] = profiler_get_percentile_ms(i, 50.0f);
+        g_block->stage_ms[i * 2 + 1] = profiler_get_percentile_ms(i, 95.0f);
+    }
+
+    g_block->sequence++;
+}
+
+int stats_shm_poll_temperature(float* out_temperature) {
+    if (!g_block) return 0;
+
+    unsigned int control_sequence = g_block->control_sequence;
+    if (control_sequence == g_last_control_sequence) {
+        return 0;
+    }
+
+    g_last_control_sequence = control_sequence;
+    *out_temperature = g_block->control_temperature;
+    return 1;
+}
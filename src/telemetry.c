@@ -0,0 +1,210 @@
+// For nanosleep under -std=c99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "types.h"
+#include "telemetry.h"
+#include "simulation.h"
+#include "plants.h"
+#include "fish.h"
+#include "temperature.h"
+
+#define TELEMETRY_DEFAULT_FILE "telemetry.bin"
+#define TELEMETRY_MAGIC 0x4C544254u  // "TBTL"
+#define TELEMETRY_VERSION 1u
+
+// Ring capacity in records; must be a power of two. At one record per
+// frame this buffers over half a minute, so the writer thread only has
+// to keep up on average.
+#define TELEMETRY_RING_SIZE 1024
+
+// One metric record per frame. All members are 4 bytes so the layout
+// has no padding and offline readers can compute offsets from the
+// header's species_slots field alone.
+typedef struct {
+    int frame;
+    int fish_count;
+    int plant_count;
+    int corpse_count;
+    float environmental_nutrition;
+    float nutrition_balance;
+    float temperature;
+    int fish_per_species[MAX_FISH_TYPES];
+} TelemetryRecord;
+
+// File header so readers can validate the layout before parsing
+typedef struct {
+    unsigned int magic;
+    unsigned int version;
+    unsigned int record_size;
+    unsigned int species_slots;
+} TelemetryHeader;
+
+// Single-producer (simulation thread) single-consumer (writer thread)
+// ring. The producer publishes a record by filling the slot and then
+// advancing the head; the consumer only reads slots behind the head,
+// so neither side takes a lock.
+static TelemetryRecord g_ring[TELEMETRY_RING_SIZE];
+static volatile unsigned int g_head = 0;
+static volatile unsigned int g_tail = 0;
+static volatile int g_dropped = 0;
+
+static int g_active = 0;
+static char g_filename[256] = TELEMETRY_DEFAULT_FILE;
+static FILE* g_log_file = NULL;
+static pthread_t g_writer_thread;
+static volatile int g_writer_running = 0;
+
+int telemetry_parse_args(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--telemetry") != 0) continue;
+
+        if (i + 1 < argc && argv[i + 1][0] != '-') {
+            strncpy(g_filename, argv[i + 1], sizeof(g_filename) - 1);
+            g_filename[sizeof(g_filename) - 1] = '\0';
+        }
+        g_active = 1;
+        return 1;
+    }
+    return 0;
+}
+
+static void writer_sleep(void) {
+#ifdef _WIN32
+    Sleep(50);
+#else
+    struct timespec ts = {0, 50 * 1000000};
+    nanosleep(&ts, NULL);
+#endif
+}
+
+// Drain everything published since the last pass to the log file
+static void drain_ring(void) {
+    unsigned int head = g_head;
+
+    while (g_tail != head) {
+        fwrite(&g_ring[g_tail % TELEMETRY_RING_SIZE],
+               sizeof(TelemetryRecord), 1, g_log_file);
+        g_tail++;
+    }
+}
+
+static void* writer_main(void* arg) {
+    (void)arg;
+
+    while (g_writer_running) {
+        drain_ring();
+        fflush(g_log_file);
+        writer_sleep();
+    }
+
+    // Final drain after the simulation stopped publishing
+    drain_ring();
+    fflush(g_log_file);
+    return NULL;
+}
+
+int telemetry_init(void) {
+    if (!g_active) return 1;
+
+    g_log_file = fopen(g_filename, "wb");
+    if (!g_log_file) {
+        printf("Failed to open telemetry log %s\n", g_filename);
+        g_active = 0;
+        return 0;
+    }
+
+    TelemetryHeader header;
+    header.magic = TELEMETRY_MAGIC;
+    header.version = TELEMETRY_VERSION;
+    header.record_size = (unsigned int)sizeof(TelemetryRecord);
+    header.species_slots = MAX_FISH_TYPES;
+    fwrite(&header, sizeof(header), 1, g_log_file);
+
+    g_head = 0;
+    g_tail = 0;
+    g_dropped = 0;
+    g_writer_running = 1;
+
+    if (pthread_create(&g_writer_thread, NULL, writer_main, NULL) != 0) {
+        printf("Failed to start telemetry writer thread\n");
+        fclose(g_log_file);
+        g_log_file = NULL;
+        g_writer_running = 0;
+        g_active = 0;
+        return 0;
+    }
+
+    printf("Telemetry recording to %s (%u-byte records)\n",
+           g_filename, (unsigned int)sizeof(TelemetryRecord));
+    return 1;
+}
+
+void telemetry_cleanup(void) {
+    if (!g_log_file) return;
+
+    g_writer_running = 0;
+    pthread_join(g_writer_thread, NULL);
+
+    fclose(g_log_file);
+    g_log_file = NULL;
+
+    if (g_dropped > 0) {
+        printf("Telemetry: %d records dropped (writer fell behind)\n", g_dropped);
+    }
+    printf("Telemetry log %s closed\n", g_filename);
+}
+
+int telemetry_is_active(void) {
+    return g_active;
+}
+
+void telemetry_record_frame(void) {
+    if (!g_active || !g_log_file) return;
+
+    unsigned int head = g_head;
+    if (head - g_tail >= TELEMETRY_RING_SIZE) {
+        // Ring full: drop rather than stall the simulation thread
+        g_dropped++;
+        return;
+    }
+
+    TelemetryRecord* record = &g_ring[head % TELEMETRY_RING_SIZE];
+    memset(record->fish_per_species, 0, sizeof(record->fish_per_species));
+
+    record->frame = simulation_get_frame_counter();
+    record->environmental_nutrition = plants_get_total_environmental_nutrition();
+    record->nutrition_balance = fish_get_nutrition_balance();
+    record->temperature = temperature_get_current();
+    record->corpse_count = simulation_get_corpse_count();
+
+    // Count fish per species in one pass over the used slots
+    Fish* all_fish = fish_get_all();
+    int highest_slot = fish_get_highest_slot();
+    int fish_count = 0;
+    for (int i = 0; i <= highest_slot; i++) {
+        if (!all_fish[i].active) continue;
+        fish_count++;
+        if (all_fish[i].fish_type >= 0 && all_fish[i].fish_type < MAX_FISH_TYPES) {
+            record->fish_per_species[all_fish[i].fish_type]++;
+        }
+    }
+    record->fish_count = fish_count;
+
+    // Active nodes split into fish nodes, corpses and plants
+    record->plant_count = simulation_get_active_node_count()
+                          - fish_count - record->corpse_count;
+
+    // Publish: advance the head only after the slot is fully written
+    g_head = head + 1;
+}
@@ -1,35 +1,61 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "types.h"
 #include "temperature.h"
 #include "simulation.h"
 #include "plants.h"
+#include "gas.h"
+#include "lazy_alloc.h"
 
 static float g_current_temperature = 0.0f;  // Temperature offset in degrees Celsius
-static int* g_bleached_nodes = NULL;        // Tracks bleached coral nodes
+static LazyBuffer g_bleach_buffer;          // Lazily committed bleach bitset
+static unsigned int* g_bleached_bits = NULL;  // One bit per node
 static int g_max_nodes = 0;
 
+// One bit per node instead of one int: 32x smaller, so the per-node
+// checks fish vision does stay in cache
+static int bleach_test(int node_id) {
+    if (node_id < 0 || !g_bleached_bits) return 0;
+    size_t word = (size_t)node_id >> 5;
+    if (word >= g_bleach_buffer.committed) return 0;
+    return (g_bleached_bits[word] >> (node_id & 31)) & 1u;
+}
+
+static void bleach_set(int node_id) {
+    if (node_id < 0 || node_id >= g_max_nodes || !g_bleached_bits) return;
+    size_t word = (size_t)node_id >> 5;
+    if (!lazy_buffer_ensure(&g_bleach_buffer, word + 1)) return;
+    g_bleached_bits[word] |= 1u << (node_id & 31);
+}
+
+static void bleach_clear(int node_id) {
+    if (node_id < 0 || !g_bleached_bits) return;
+    size_t word = (size_t)node_id >> 5;
+    if (word >= g_bleach_buffer.committed) return;
+    g_bleached_bits[word] &= ~(1u << (node_id & 31));
+}
+
 int temperature_init(void) {
     g_current_temperature = 0.0f;
     g_max_nodes = MAX_NODES;
-    
-    g_bleached_nodes = (int*)calloc(g_max_nodes, sizeof(int));
-    if (!g_bleached_nodes) {
+
+    if (!lazy_buffer_init(&g_bleach_buffer, sizeof(unsigned int),
+                          ((size_t)g_max_nodes + 31) / 32)) {
         printf("Failed to allocate bleached nodes tracking\n");
         return 0;
     }
-    
+    g_bleached_bits = (unsigned int*)g_bleach_buffer.base;
+
     printf("Temperature system initialized (0.0°C - no bleaching)\n");
     return 1;
 }
 
 void temperature_cleanup(void) {
-    if (g_bleached_nodes) {
-        free(g_bleached_nodes);
-        g_bleached_nodes = NULL;
-    }
+    lazy_buffer_cleanup(&g_bleach_buffer);
+    g_bleached_bits = NULL;
 }
 
 float temperature_get_current(void) {
@@ -45,10 +71,42 @@ void temperature_set_current(float temp) {
 }
 
 int temperature_is_coral_bleached(int node_id) {
-    if (node_id < 0 || node_id >= g_max_nodes || !g_bleached_nodes) {
-        return 0;
+    return bleach_test(node_id);
+}
+
+// Carry bleach state along when simulation compaction moves a node
+void temperature_move_bleach_state(int from_node, int to_node) {
+    if (bleach_test(from_node)) {
+        bleach_set(to_node);
+    } else {
+        bleach_clear(to_node);
     }
-    return g_bleached_nodes[node_id];
+    bleach_clear(from_node);
+}
+
+// Snapshot support: one bitset word covers 32 nodes
+int temperature_snapshot_word_count(int node_count) {
+    if (node_count <= 0) return 0;
+    return (node_count + 31) / 32;
+}
+
+// Copy the bitset words covering the saved nodes; words past the
+// committed region have never been touched and read as zero
+void temperature_snapshot_write(unsigned int* dest, int word_count) {
+    for (int w = 0; w < word_count; w++) {
+        dest[w] = ((size_t)w < g_bleach_buffer.committed) ? g_bleached_bits[w] : 0u;
+    }
+}
+
+// Replace the bitset with the words from a snapshot. The pre-load
+// world's bits are cleared first so they cannot mark arbitrary
+// restored nodes as bleached
+void temperature_snapshot_restore(const unsigned int* bits, int word_count) {
+    if (!g_bleached_bits) return;
+    memset(g_bleached_bits, 0, g_bleach_buffer.committed * sizeof(unsigned int));
+    if (word_count <= 0) return;
+    if (!lazy_buffer_ensure(&g_bleach_buffer, (size_t)word_count)) return;
+    memcpy(g_bleached_bits, bits, (size_t)word_count * sizeof(unsigned int));
 }
 
 void temperature_process_coral_bleaching(void) {
@@ -58,7 +116,8 @@ void temperature_process_coral_bleaching(void) {
     
     Node* nodes = simulation_get_nodes();
     int node_count = simulation_get_node_count();
-    
+    if (node_count <= 0) return;
+
     // Temperature-based bleaching probability
     float base_probability;
     if (g_current_temperature < 0.5f) {
@@ -82,17 +141,20 @@ void temperature_process_coral_bleaching(void) {
     int bleaching_attempts = 0;
     int max_attempts_per_frame = 1;
     
-    // Check only subset of nodes per frame for performance
-    int nodes_to_check = node_count / 20;
+    // Sample a random subset per frame. Sizing the sample from the
+    // active population (not the slot count) keeps the expected
+    // bleaching rate steady as dead slots accumulate between
+    // compactions, which also keep the array at least half live.
+    int nodes_to_check = simulation_get_active_node_count() / 20;
     if (nodes_to_check < 1) nodes_to_check = 1;
     if (nodes_to_check > 50) nodes_to_check = 50;
-    
+
     for (int attempt = 0; attempt < nodes_to_check && bleaching_attempts < max_attempts_per_frame; attempt++) {
         int i = rand() % node_count;
-        
+
         if (!nodes[i].active) continue;
         if (nodes[i].plant_type == -1) continue;  // Skip fish nodes
-        if (g_bleached_nodes[i]) continue;       // Already bleached
+        if (bleach_test(i)) continue;            // Already bleached
         
         // Only coral species can bleach
         PlantType* plant_type = plants_get_type(nodes[i].plant_type);
@@ -107,7 +169,7 @@ void temperature_process_coral_bleaching(void) {
         
         // Age factor - older corals more susceptible
         float age_factor = 1.0f;
-        if (nodes[i].age > plant_type->age_mature) {
+        if (simulation_get_frame_counter() - nodes[i].birth_frame > plant_type->age_mature) {
             age_factor = 1.5f;
         }
         
@@ -116,8 +178,11 @@ void temperature_process_coral_bleaching(void) {
         float adjusted_probability = base_probability * age_factor;
         
         if (random_val < adjusted_probability) {
-            g_bleached_nodes[i] = 1;
+            bleach_set(i);
             bleaching_attempts++;
+
+            // Bleached coral stops producing oxygen
+            gas_mark_plant_changed(nodes[i].x, nodes[i].y, nodes[i].plant_type);
             
             printf("Coral bleaching event: Node %d at temperature %.1f°C\n", 
                    i, g_current_temperature);
@@ -138,9 +203,12 @@ void temperature_process_coral_bleaching(void) {
                         if (nodes[connected_node].active && nodes[connected_node].plant_type >= 0) {
                             PlantType* connected_type = plants_get_type(nodes[connected_node].plant_type);
                             if (connected_type && strstr(connected_type->name, "Coral") != NULL) {
-                                if (!g_bleached_nodes[connected_node]) {
-                                    g_bleached_nodes[connected_node] = 1;
+                                if (!bleach_test(connected_node)) {
+                                    bleach_set(connected_node);
                                     chains_bleached++;
+                                    gas_mark_plant_changed(nodes[connected_node].x,
+                                                           nodes[connected_node].y,
+                                                           nodes[connected_node].plant_type);
                                 }
                             }
                         }
@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "worker_pool.h"
+
+#define MAX_WORKER_THREADS 32
+
+// Persistent worker pool shared by physics and other parallel stages
+static pthread_t g_threads[MAX_WORKER_THREADS];
+static int g_thread_count = 0;
+static int g_pool_running = 0;
+
+// Work dispatch state (guarded by g_mutex)
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_done_cond = PTHREAD_COND_INITIALIZER;
+
+static WorkerTask g_task = NULL;
+static void* g_context = NULL;
+static int g_item_count = 0;
+static int g_next_item = 0;
+static int g_active_workers = 0;
+static unsigned int g_generation = 0;
+static int g_shutdown = 0;
+
+// Detect available hardware threads
+static int detect_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (int)count : 1;
+#endif
+}
+
+// Worker threads pull item indices from a shared counter until the
+// current batch is drained, then wait for the next generation
+static void* worker_main(void* arg) {
+    (void)arg;
+    unsigned int last_generation = 0;
+
+    pthread_mutex_lock(&g_mutex);
+    for (;;) {
+        while (!g_shutdown && g_generation == last_generation) {
+            pthread_cond_wait(&g_work_cond, &g_mutex);
+        }
+        if (g_shutdown) break;
+
+        last_generation = g_generation;
+
+        while (g_next_item < g_item_count) {
+            int item = g_next_item++;
+            pthread_mutex_unlock(&g_mutex);
+            g_task(item, g_context);
+            pthread_mutex_lock(&g_mutex);
+        }
+
+        g_active_workers--;
+        if (g_active_workers == 0) {
+            pthread_cond_signal(&g_done_cond);
+        }
+    }
+    pthread_mutex_unlock(&g_mutex);
+
+    return NULL;
+}
+
+int worker_pool_init(void) {
+    if (g_pool_running) return 1;
+
+    int cpu_count = detect_cpu_count();
+    g_thread_count = cpu_count;
+    if (g_thread_count > MAX_WORKER_THREADS) g_thread_count = MAX_WORKER_THREADS;
+    if (g_thread_count < 1) g_thread_count = 1;
+
+    g_shutdown = 0;
+    g_generation = 0;
+
+    for (int i = 0; i < g_thread_count; i++) {
+        if (pthread_create(&g_threads[i], NULL, worker_main, NULL) != 0) {
+            printf("Worker pool: failed to create thread %d, running with %d\n", i, i);
+            g_thread_count = i;
+            break;
+        }
+    }
+
+    if (g_thread_count == 0) {
+        // No threads available - worker_pool_run falls back to serial
+        g_thread_count = 1;
+        printf("Worker pool unavailable, tasks will run single-threaded\n");
+        return 1;
+    }
+
+    g_pool_running = 1;
+    printf("Worker pool initialized: %d threads (%d cores detected)\n",
+           g_thread_count, cpu_count);
+    return 1;
+}
+
+void worker_pool_cleanup(void) {
+    if (!g_pool_running) return;
+
+    pthread_mutex_lock(&g_mutex);
+    g_shutdown = 1;
+    pthread_cond_broadcast(&g_work_cond);
+    pthread_mutex_unlock(&g_mutex);
+
+    for (int i = 0; i < g_thread_count; i++) {
+        pthread_join(g_threads[i], NULL);
+    }
+
+    g_pool_running = 0;
+    g_thread_count = 0;
+}
+
+int worker_pool_get_thread_count(void) {
+    return (g_thread_count > 0) ? g_thread_count : 1;
+}
+
+void worker_pool_run(WorkerTask task, void* context, int item_count) {
+    if (item_count <= 0) return;
+
+    // Serial fallback when the pool is not running
+    if (!g_pool_running) {
+        for (int i = 0; i < item_count; i++) {
+            task(i, context);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&g_mutex);
+
+    g_task = task;
+    g_context = context;
+    g_item_count = item_count;
+    g_next_item = 0;
+    g_active_workers = g_thread_count;
+    g_generation++;
+
+    pthread_cond_broadcast(&g_work_cond);
+
+    while (g_active_workers > 0) {
+        pthread_cond_wait(&g_done_cond, &g_mutex);
+    }
+
+    g_task = NULL;
+    g_context = NULL;
+    g_item_count = 0;
+
+    pthread_mutex_unlock(&g_mutex);
+}